@@ -1,14 +1,19 @@
 #include "berts/berts.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <vector>
 #include "berts/berts.hpp"
 #include "berts/models/gguf.hpp"
 #include "berts/models/internal.hpp"
 #include "berts/models/log.hpp"
+#include "berts/models/parallel.hpp"
 
 namespace internal = berts::internal;
 namespace gguf = berts::gguf;
 namespace log = berts::log;
+namespace parallel = berts::parallel;
 
 #define BERTS_VERSION_MAJOR 0
 #define BERTS_VERSION_MINOR 3
@@ -50,6 +55,14 @@ void berts_set_log_file(FILE *file) {
     log::set_log_file(file);
 }
 
+void berts_set_log_async(bool async) {
+    log::set_log_async(async);
+}
+
+void berts_flush_log(void) {
+    log::flush();
+}
+
 void berts_free(berts_context *ctx) {
     internal::free_context(ctx);
 }
@@ -58,6 +71,72 @@ berts_context *berts_load_from_file(const char *path) {
     return gguf::load_from_file(path);
 }
 
+void berts_init_load_params(berts_load_params *params) {
+    if (params) {
+        params->use_mmap = false;
+        params->use_huge_pages = false;
+    }
+}
+
+berts_context *berts_load_from_file_with_params(const char *path,
+                                                const berts_load_params *params) {
+    berts_load_params params_{};
+    berts_init_load_params(&params_);
+    if (params) {
+        params_ = *params;
+    }
+    return gguf::load_from_file(path, params_);
+}
+
+bool berts_memory_usage(const berts_context *ctx,
+                        berts_memory_stats *stats) {
+    if (!internal::check_ctx(ctx)) {
+        return false;
+    }
+
+    if (stats) {
+        internal::get_memory_usage(ctx, *stats);
+    }
+
+    return true;
+}
+
+bool berts_estimate_memory(const char *path,
+                           size_t max_tokens,
+                           size_t batch,
+                           const berts_load_params *params,
+                           berts_memory_stats *stats) {
+    berts_load_params params_{};
+    berts_init_load_params(&params_);
+    if (params) {
+        params_ = *params;
+    }
+
+    berts_memory_stats stats_{};
+    if (!gguf::estimate_memory(path, max_tokens, batch, params_, stats_)) {
+        return false;
+    }
+
+    if (stats) {
+        *stats = stats_;
+    }
+
+    return true;
+}
+
+bool berts_get_huge_pages_info(const berts_context *ctx,
+                               berts_huge_pages_info *info) {
+    if (!internal::check_ctx(ctx)) {
+        return false;
+    }
+
+    if (info) {
+        internal::get_huge_pages_info(ctx, *info);
+    }
+
+    return true;
+}
+
 // berts_context *berts_load_from_memory(const uint8_t *data, size_t data_len) {
 //     return gguf::load_from_memory(const uint8_t *data, size_t data_len);
 // }
@@ -148,14 +227,13 @@ size_t berts_vocab_size(const berts_context *ctx) {
     return model.vocab_count();
 }
 
-bool berts_tokenize(const berts_context *ctx,
-                    const char *text,
-                    bert_token_t *out,
-                    size_t *out_len) {
-    BERTS_CHECK_MODEL_OR(false);
-
-    std::vector<bert_token_t> ids;
-
+// [CLS] + tokens + [SEP]
+static bool tokenize_with_cls_sep(const berts_context *ctx,
+                                  const internal::model &model,
+                                  std::string_view text,
+                                  std::vector<bert_token_t> &ids,
+                                  std::vector<berts_token_span> *spans,
+                                  int n_threads) {
     auto cls_id = model.cls_id();
     auto sep_id = model.sep_id();
 
@@ -169,33 +247,226 @@ bool berts_tokenize(const berts_context *ctx,
         return false;
     }
 
-    ids.reserve(std::strlen(text) + 2 /* cls, sep */);
     ids.push_back(cls_id);
+    if (spans) spans->push_back({0, 0});
+
+    if (!model.tokenize(ctx, text, ids, spans, n_threads)) {
+        return false;
+    }
+
+    ids.push_back(sep_id);
+    if (spans) spans->push_back({text.size(), text.size()});
+    return true;
+}
+
+static void warn_too_long(const berts_context *ctx, size_t token_count) {
+    const auto max_tokens = (size_t)internal::get_hparams(ctx).max_tokens;
+    if (max_tokens < token_count) {
+        log::warn(
+            "Token count ({}) is larger than the max_position_embeddings ({}). "
+            "Calling eval() with this sequence will cause a failure.",
+            token_count,
+            max_tokens);
+    }
+}
+
+// buffers reused by tokenization on each thread
+struct tokenize_scratch {
+    std::vector<bert_token_t> ids;
+    std::vector<berts_token_span> spans;
+};
+
+static tokenize_scratch &get_tokenize_scratch() {
+    thread_local tokenize_scratch scratch{};
+    scratch.ids.clear();
+    scratch.spans.clear();
+    return scratch;
+}
+
+bool berts_tokenize(const berts_context *ctx,
+                    const char *text,
+                    bert_token_t *out,
+                    size_t *out_len) {
+    if (!text) {
+        log::error("text is NULL");
+        return false;
+    }
+    return berts_tokenize_into(ctx, text, std::strlen(text), nullptr, out, nullptr, out_len);
+}
+
+void berts_init_tokenize_info(berts_tokenize_info *cond) {
+    if (cond) {
+        cond->n_threads = 1;
+    }
+}
 
-    bool ok = model.tokenize(ctx, text, ids);
+bool berts_tokenize_into(const berts_context *ctx,
+                         const char *text,
+                         size_t text_len,
+                         const berts_tokenize_info *cond,
+                         bert_token_t *out,
+                         berts_token_span *spans,
+                         size_t *out_len) {
+    BERTS_CHECK_MODEL_OR(false);
+
+    if (!text) {
+        log::error("text is NULL");
+        return false;
+    }
+
+    berts_tokenize_info cond_{};
+    berts_init_tokenize_info(&cond_);
+    if (cond) {
+        cond_ = *cond;
+    }
+
+    // intra-text parallelism is opt-in
+    const int n_threads = std::max(cond_.n_threads, 1);
+
+    auto &scratch = get_tokenize_scratch();
+    auto &ids = scratch.ids;
+
+    bool ok = tokenize_with_cls_sep(ctx, model, {text, text_len}, ids, spans ? &scratch.spans : nullptr, n_threads);
 
     if (ok) {
-        ids.push_back(sep_id);
         if (out_len) {
             size_t out_len_ = std::min(*out_len, ids.size());
             *out_len = ids.size();
             if (out) std::copy(ids.begin(), ids.begin() + out_len_, out);
+            if (spans) std::copy(scratch.spans.begin(), scratch.spans.begin() + out_len_, spans);
         }
     }
 
-    internal::hparams hparams{};
-    internal::get_hparams(ctx, &hparams);
-    if ((size_t)hparams.max_tokens < ids.size()) {
-        log::warn(
-            "Token count ({}) is larger than the max_position_embeddings ({}). "
-            "Calling eval() with this sequence will cause a failure.",
-            ids.size(),
-            hparams.max_tokens);
-    }
+    warn_too_long(ctx, ids.size());
 
     return ok;
 }
 
+bool berts_get_tokenizer_cache_stats(const berts_context *ctx,
+                                     berts_tokenizer_cache_stats *stats) {
+    BERTS_CHECK_MODEL_OR(false);
+
+    if (stats) {
+        model.tokenizer_cache_stats(*stats);
+    }
+
+    return true;
+}
+
+void berts_init_tokenize_batch_info(berts_tokenize_batch_info *cond) {
+    if (cond) {
+        cond->n_threads = -1;
+    }
+}
+
+bool berts_tokenize_batch(const berts_context *ctx,
+                          const char *const *texts,
+                          size_t n,
+                          const berts_tokenize_batch_info *cond,
+                          bert_token_t *out,
+                          size_t *out_len,
+                          size_t *offsets,
+                          berts_padded_batch *padded) {
+    BERTS_CHECK_MODEL_OR(false);
+
+    if (n != 0 && !texts) {
+        log::error("texts is NULL");
+        return false;
+    }
+
+    if (out && !out_len) {
+        log::error("out_len is NULL");
+        return false;
+    }
+
+    if (padded && padded->max_len != 0 && !padded->ids) {
+        log::error("padded->ids is NULL");
+        return false;
+    }
+
+    if (padded && padded->max_len == 1) {
+        // no room for both [CLS] and [SEP]
+        log::error("padded->max_len must be 0 or at least 2");
+        return false;
+    }
+
+    berts_tokenize_batch_info cond_{};
+    berts_init_tokenize_batch_info(&cond_);
+    if (cond) {
+        cond_ = *cond;
+    }
+
+    const size_t n_threads = cond_.n_threads <= 0 ? GGML_DEFAULT_N_THREADS : cond_.n_threads;
+
+    // texts are tokenized in parallel, so each text uses one thread
+    std::vector<std::vector<bert_token_t>> results(n);
+    std::atomic_bool ok{true};
+    parallel::parallel_for(n, n_threads, [&](size_t i) {
+        if (!ok) return;
+        if (!texts[i] || !tokenize_with_cls_sep(ctx, model, texts[i], results[i], nullptr, 1)) {
+            log::error("failed to tokenize texts[{}]", i);
+            ok = false;
+        }
+    });
+
+    if (!ok) {
+        return false;
+    }
+
+    size_t total = 0;
+    size_t longest = 0;
+    for (const auto &ids : results) {
+        total += ids.size();
+        longest = std::max(longest, ids.size());
+    }
+
+    if (out && *out_len < total) {
+        log::error("out is too small: {} < {}", *out_len, total);
+        *out_len = total;
+        return false;
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (offsets) offsets[i] = offset;
+        if (out) std::copy(results[i].begin(), results[i].end(), out + offset);
+        offset += results[i].size();
+    }
+    if (offsets) offsets[n] = offset;
+    if (out_len) *out_len = total;
+
+    if (padded) {
+        if (padded->max_len == 0) {
+            padded->max_len = longest;
+        } else {
+            const size_t len = padded->max_len;
+            const auto pad_id = model.pad_id();
+            for (size_t i = 0; i < n; ++i) {
+                const auto &ids = results[i];
+                const size_t m = std::min(len, ids.size());
+                auto row = padded->ids + i * len;
+                std::copy(ids.begin(), ids.begin() + m, row);
+                std::fill(row + m, row + len, pad_id);
+                if (m < ids.size()) {
+                    row[m - 1] = ids.back(); // [SEP]
+                }
+                if (padded->segments) {
+                    std::fill(padded->segments + i * len, padded->segments + (i + 1) * len, 0);
+                }
+                if (padded->mask) {
+                    auto mask = padded->mask + i * len;
+                    std::fill(mask, mask + m, 1);
+                    std::fill(mask + m, mask + len, 0);
+                }
+            }
+        }
+    }
+
+    warn_too_long(ctx, longest);
+
+    return true;
+}
+
 //
 // inference
 //
@@ -206,6 +477,7 @@ void berts_init_eval_info(berts_eval_info *cond) {
         cond->pool_type = BERTS_POOL_CLS;
         // cond->output_all_layers = false;
         cond->n_threads = -1;
+        cond->timings = nullptr;
     }
 }
 
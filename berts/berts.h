@@ -72,6 +72,14 @@ BERTS_API FILE *berts_get_log_file(void);
 
 BERTS_API void berts_set_log_file(FILE *file);
 
+/// @brief write log messages on a background thread (default: false)
+/// @note when the queue is full, messages are dropped and the number of dropped messages is reported later
+/// @note queued messages are lost if the process aborts; call `berts_flush_log` before exiting abnormally
+BERTS_API void berts_set_log_async(bool async);
+
+/// @brief wait until the queued log messages are written
+BERTS_API void berts_flush_log(void);
+
 //
 // context
 //
@@ -82,6 +90,75 @@ BERTS_API void berts_free(berts_context *ctx);
 
 BERTS_API berts_context *berts_load_from_file(const char *path);
 
+struct berts_load_params {
+    // map the model file instead of copying tensor data
+    // falls back to copying if mapping is not possible
+    bool use_mmap;
+
+    // back weights and scratch buffers with huge pages (2 MiB)
+    // falls back to normal pages if huge pages are not available
+    bool use_huge_pages;
+};
+
+BERTS_API void berts_init_load_params(berts_load_params *params);
+
+/// @brief load model with given parameters
+/// @param params loading parameters, can be NULL; if NULL, default values are used
+/// @note if the model is already loaded in the process with the same `use_mmap` and `use_huge_pages`, weights are shared;
+///       otherwise a separate copy of weights is loaded
+BERTS_API berts_context *berts_load_from_file_with_params(const char *path,
+                                                          const berts_load_params *params);
+
+struct berts_huge_pages_info {
+    // total bytes of weights, and bytes of them backed by huge pages
+    size_t weights_size;
+    size_t weights_huge;
+
+    // total bytes of scratch buffers, and bytes of them backed by huge pages
+    size_t scratch_size;
+    size_t scratch_huge;
+};
+
+/// @brief report how much memory is actually backed by huge pages
+/// @note huge page bytes are read from /proc/self/smaps and are always 0 on other platforms
+BERTS_API bool berts_get_huge_pages_info(const berts_context *ctx,
+                                         berts_huge_pages_info *info);
+
+struct berts_memory_stats {
+    // tensor data of weights
+    // shared between contexts loaded from the same file
+    size_t weights;
+
+    // vocab, trie and BPE tables
+    // shared between contexts loaded from the same file
+    size_t vocab;
+
+    // scratch arena for the compute graph and its tensors (per-context)
+    size_t scratch;
+
+    // work buffer of the compute plan (per-context)
+    size_t plan;
+
+    // the largest scratch + plan size requested by one eval so far (per-context)
+    size_t scratch_peak;
+};
+
+/// @brief report memory used by the context
+BERTS_API bool berts_memory_usage(const berts_context *ctx,
+                                  berts_memory_stats *stats);
+
+/// @brief estimate memory needed to load the model and run eval, without loading it
+/// @param path path to the model file; only the header is read
+/// @param max_tokens number of tokens per eval; 0 for the model's max_tokens
+/// @param batch number of evals running at the same time (each needs its own scratch buffers)
+/// @param params loading parameters, can be NULL; if NULL, default values are used
+/// @param stats [out] estimated memory; `scratch` and `plan` are the sum for `batch` evals and `scratch_peak` is for one eval
+BERTS_API bool berts_estimate_memory(const char *path,
+                                     size_t max_tokens,
+                                     size_t batch,
+                                     const berts_load_params *params,
+                                     berts_memory_stats *stats);
+
 // BERTS_API berts_context *berts_load_from_memory(const uint8_t *data, size_t data_len);
 
 enum bert_type {
@@ -127,6 +204,100 @@ BERTS_API bool berts_tokenize(const berts_context *ctx,
                               bert_token_t *out,
                               size_t *out_len);
 
+/// @brief byte range [begin, end) of a token in the input text
+struct berts_token_span {
+    size_t begin;
+    size_t end;
+};
+
+struct berts_tokenize_info {
+    // a number of threads used to tokenize one text;
+    // a long text (>= 128 KiB) is split into chunks which are tokenized in parallel
+    // <=1 for one thread (default)
+    int n_threads;
+};
+
+BERTS_API void berts_init_tokenize_info(berts_tokenize_info *cond);
+
+/// @brief tokenize into caller-provided buffers like `berts_tokenize`, optionally with the byte range of each token
+/// @note working buffers are kept per thread and reused, so repeated calls do not allocate heap memory
+///       once the buffers and the word cache are warmed up
+/// @param text UTF-8 text, need not be null-terminated
+/// @param text_len length of `text` in bytes
+/// @param cond tokenization condition, can be NULL; if NULL, default values are used
+/// @param out token IDs ([CLS] + tokens + [SEP]), can be NULL
+/// @param spans [out] byte range in `text` of each token, can be NULL;
+///              [CLS] and [SEP] are empty ranges at the start and the end of the text.
+///              if normalization changes the bytes of a word, its tokens get the range of the whole word
+///              (of the text between spaces for Unicode normalization)
+/// @param out_len [in,out] capacity of `out` and `spans`; the number of tokens is written (results beyond the capacity are dropped)
+BERTS_API bool berts_tokenize_into(const berts_context *ctx,
+                                   const char *text,
+                                   size_t text_len,
+                                   const berts_tokenize_info *cond,
+                                   bert_token_t *out,
+                                   berts_token_span *spans,
+                                   size_t *out_len);
+
+struct berts_tokenizer_cache_stats {
+    // lookups of the word cache (words of WordPiece, pre-tokenized pieces of BPE)
+    uint64_t hits;
+    uint64_t misses;
+
+    // cached words and the max number of them
+    size_t entries;
+    size_t capacity;
+};
+
+/// @brief report hits and misses of the word cache used by the tokenizer
+/// @note the cache is shared between contexts loaded from the same file
+BERTS_API bool berts_get_tokenizer_cache_stats(const berts_context *ctx,
+                                               berts_tokenizer_cache_stats *stats);
+
+struct berts_tokenize_batch_info {
+    // a number of threads used in `tokenize_batch`
+    // <=0 for default value (= 4)
+    int n_threads;
+};
+
+BERTS_API void berts_init_tokenize_batch_info(berts_tokenize_batch_info *cond);
+
+/// @brief padded (batch, max_len) layout written by `berts_tokenize_batch`
+struct berts_padded_batch {
+    // length of each row; if 0, the longest sequence length is written and no arrays are written
+    // sequences longer than `max_len` are truncated and end with [SEP], so it must be 0 or at least 2
+    size_t max_len;
+
+    // (batch, max_len) token IDs filled with [PAD]
+    bert_token_t *ids;
+
+    // (batch, max_len) segment IDs (all 0), can be NULL
+    bert_segment_t *segments;
+
+    // (batch, max_len) attention mask (1 for tokens, 0 for paddings), can be NULL
+    uint8_t *mask;
+};
+
+/// @brief tokenize `n` texts in parallel; each result is surrounded by [CLS] and [SEP] like `berts_tokenize`
+/// @param texts null-terminated texts
+/// @param n number of texts
+/// @param cond tokenization condition, can be NULL; if NULL, default values are used
+/// @param out flat buffer of token IDs; IDs of `texts[i]` are `out[offsets[i]:offsets[i+1]]`, can be NULL
+/// @param out_len input and written length of `out`; if `out` is NULL or too small, needed length is written; must not be NULL if `out` is given
+/// @param offsets [out] `n + 1` offsets into `out`, can be NULL
+/// @param padded [in,out] padded layout, can be NULL
+/// @note a call to query the needed length tokenizes all texts, so querying first tokenizes every text twice;
+///       to do it in one pass, give `out` of `strlen(texts[i]) + 2` summed over the texts (an upper bound),
+///       or request only `padded` with a fixed `max_len`
+BERTS_API bool berts_tokenize_batch(const berts_context *ctx,
+                                    const char *const *texts,
+                                    size_t n,
+                                    const berts_tokenize_batch_info *cond,
+                                    bert_token_t *out,
+                                    size_t *out_len,
+                                    size_t *offsets,
+                                    berts_padded_batch *padded);
+
 //
 // inference
 //
@@ -145,6 +316,19 @@ enum berts_pool_type {
     BERTS_POOL_MAX,
 };
 
+/// @brief time spent in each phase of `berts_eval`
+struct berts_eval_timings {
+    // microseconds
+    int64_t graph_us;   // building the compute graph
+    int64_t plan_us;    // planning the computation and getting its work buffer
+    int64_t compute_us; // running the computation
+    int64_t output_us;  // copying the result to `out`
+
+    // bytes of the graph arena and of the work buffer used by the eval
+    size_t graph_size;
+    size_t work_size;
+};
+
 struct berts_eval_info {
     // specify output layer
     // negative value is allowed (indexed from behind)
@@ -186,6 +370,10 @@ struct berts_eval_info {
     // a number of threads used in `eval`
     // <=0 for default value (= 4)
     int n_threads;
+
+    // [out] written with the time spent in each phase, can be NULL (default)
+    // not written by a dry run
+    berts_eval_timings *timings;
 };
 
 BERTS_API void berts_init_eval_info(berts_eval_info *cond);
@@ -0,0 +1,778 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "berts/berts.h"
+#include "berts/models/keys.h"
+
+//
+// encoder benchmark
+//
+// sweeps token counts, thread counts, pooling types, output layers and weight types,
+// and reports the time of each phase of `berts_eval` with the achieved FLOP rate.
+// models are given as GGUF files, or synthesized with random weights in BERT-base/large shapes.
+//
+
+static void show_usage(const char *exe) {
+    printf("usage: %s [options] [model.gguf ...]\n", exe);
+    printf("\n");
+    printf("options:\n");
+    printf("  --synth SHAPE  benchmark a model with random weights; SHAPE = base | large (repeatable)\n");
+    printf("  -q TYPES       weight types, quantized from each model (default: as stored; e.g. f16,q8_0,q4_0)\n");
+    printf("  -n TOKENS      token counts (default: 8,16,32,64,128,256,512)\n");
+    printf("  -t THREADS     thread counts (default: 1,<hardware concurrency>)\n");
+    printf("  -p POOLS       pooling types none | cls | avg | max (default: cls)\n");
+    printf("  -l LAYERS      output layers (default: -1)\n");
+    printf("  -r N           timed repetitions per configuration (default: 5)\n");
+    printf("  -f FORMAT      json | csv (default: json)\n");
+    printf("  -o PATH        write results to PATH (default: stdout)\n");
+    printf("  -w DIR         directory of synthesized and quantized models (default: temporary directory)\n");
+    printf("\n");
+    printf("lists are comma-separated.\n");
+    printf("\n");
+}
+
+//
+// model shapes
+//
+
+struct shape {
+    const char *name;
+    uint32_t vocab_size;
+    uint32_t hidden_dim;
+    uint32_t n_layers;
+    uint32_t attn_heads;
+    uint32_t max_tokens;
+    uint32_t intermediate_dim;
+    uint32_t segment_count;
+};
+
+static constexpr std::array<shape, 2> shapes{{
+    {"bert-base", 30522, 768, 12, 12, 512, 3072, 2},
+    {"bert-large", 30522, 1024, 24, 16, 512, 4096, 2},
+}};
+
+/// @brief read hparams from the header of a GGUF file
+static bool read_shape(const std::string &path, shape &s) {
+    gguf_init_params params{
+        /* .no_alloc = */ true,
+        /* .ctx      = */ nullptr,
+    };
+    gguf_context *gguf = gguf_init_from_file(path.c_str(), params);
+    if (!gguf) {
+        return false;
+    }
+
+    bool ok = true;
+    auto u32 = [&](const char *key, uint32_t default_) {
+        const int idx = gguf_find_key(gguf, key);
+        if (idx < 0) {
+            if (default_ == 0) ok = false;
+            return default_;
+        }
+        return gguf_get_val_u32(gguf, idx);
+    };
+
+    s.name = "";
+    s.vocab_size = u32(BERTS_KEY_HPARAM_VOCAB_SIZE, 0);
+    s.hidden_dim = u32(BERTS_KEY_HPARAM_HIDDEN_DIM, 0);
+    s.n_layers = u32(BERTS_KEY_HPARAM_N_LAYERS, 0);
+    s.attn_heads = u32(BERTS_KEY_HPARAM_ATTN_HEADS, 0);
+    s.max_tokens = u32(BERTS_KEY_HPARAM_MAX_TOKENS, 0);
+    s.intermediate_dim = u32(BERTS_KEY_HPARAM_INTERMEDIATE_DIM, 0);
+    s.segment_count = u32(BERTS_KEY_HPARAM_SEGM_COUNT, 2);
+
+    gguf_free(gguf);
+    return ok;
+}
+
+/// @brief FLOPs of the encoder layers for `n` tokens (a multiply-add counts as 2)
+static double encoder_flops(const shape &s, size_t n, size_t n_layers) {
+    const double d = s.hidden_dim;
+    const double f = s.intermediate_dim;
+    const double t = (double)n;
+    const double per_layer =
+        2 * t * d * d * 3 + // Q, K, V
+        2 * t * t * d * 2 + // QK^T and softmax(QK^T)V
+        2 * t * d * d +     // attention output
+        2 * t * d * f * 2;  // feed forward
+    return per_layer * (double)n_layers;
+}
+
+//
+// synthesized model
+//
+
+static constexpr const char *KEY_PREFIX = "berts.bert.";
+
+/// @brief write a BERT model with random weights in the format of convert_hf_to_gguf.py
+static bool synthesize(const shape &s, const std::string &path) {
+    const uint32_t d = s.hidden_dim;
+    const uint32_t f = s.intermediate_dim;
+
+    // vocab: special tokens, then dummy words
+    std::vector<std::string> tokens{"[PAD]", "[UNK]", "[CLS]", "[SEP]", "[MASK]"};
+    for (char c = 'a'; c <= 'z'; ++c) {
+        tokens.emplace_back(1, c);
+        tokens.push_back(std::string{"##"} + c);
+    }
+    while (tokens.size() < s.vocab_size) {
+        tokens.push_back("w" + std::to_string(tokens.size()));
+    }
+
+    std::vector<int8_t> vocab_size{};
+    std::vector<int8_t> vocab_data{};
+    for (const auto &token : tokens) {
+        vocab_size.push_back((int8_t)token.size());
+        vocab_data.insert(vocab_data.end(), token.begin(), token.end());
+    }
+
+    //
+    // tensors (metadata only)
+    //
+
+    struct entry {
+        std::string name;
+        int64_t ne0;
+        int64_t ne1; // 0 for 1D
+        enum { RANDOM, ONES, ZEROS, VOCAB_SIZE, VOCAB_DATA } init;
+    };
+
+    std::vector<entry> entries{};
+    auto add = [&](std::string name, int64_t ne0, int64_t ne1, auto init) {
+        entries.push_back(entry{KEY_PREFIX + name, ne0, ne1, init});
+    };
+
+    add("embeddings.word_embeddings.weight", d, s.vocab_size, entry::RANDOM);
+    add("embeddings.token_type_embeddings.weight", d, s.segment_count, entry::RANDOM);
+    add("embeddings.position_embeddings.weight", d, s.max_tokens, entry::RANDOM);
+    add("embeddings.LayerNorm.weight", d, 0, entry::ONES);
+    add("embeddings.LayerNorm.bias", d, 0, entry::ZEROS);
+
+    for (uint32_t n = 0; n < s.n_layers; ++n) {
+        const std::string layer = "encoder.layer." + std::to_string(n) + ".";
+        add(layer + "attention.self.query.weight", d, d, entry::RANDOM);
+        add(layer + "attention.self.query.bias", d, 0, entry::ZEROS);
+        add(layer + "attention.self.key.weight", d, d, entry::RANDOM);
+        add(layer + "attention.self.key.bias", d, 0, entry::ZEROS);
+        add(layer + "attention.self.value.weight", d, d, entry::RANDOM);
+        add(layer + "attention.self.value.bias", d, 0, entry::ZEROS);
+        add(layer + "attention.output.dense.weight", d, d, entry::RANDOM);
+        add(layer + "attention.output.dense.bias", d, 0, entry::ZEROS);
+        add(layer + "attention.output.LayerNorm.weight", d, 0, entry::ONES);
+        add(layer + "attention.output.LayerNorm.bias", d, 0, entry::ZEROS);
+        add(layer + "intermediate.dense.weight", d, f, entry::RANDOM);
+        add(layer + "intermediate.dense.bias", f, 0, entry::ZEROS);
+        add(layer + "output.dense.weight", f, d, entry::RANDOM);
+        add(layer + "output.dense.bias", d, 0, entry::ZEROS);
+        add(layer + "output.LayerNorm.weight", d, 0, entry::ONES);
+        add(layer + "output.LayerNorm.bias", d, 0, entry::ZEROS);
+    }
+
+    add("pooler.dense.weight", d, d, entry::RANDOM);
+    add("pooler.dense.bias", d, 0, entry::ZEROS);
+
+    entries.push_back(entry{BERTS_KEY_ALL_VOCAB_SIZE, (int64_t)vocab_size.size(), 0, entry::VOCAB_SIZE});
+    entries.push_back(entry{BERTS_KEY_ALL_VOCAB_DATA, (int64_t)vocab_data.size(), 0, entry::VOCAB_DATA});
+
+    ggml_init_params init{
+        /* .mem_size   = */ ggml_tensor_overhead() * (entries.size() + 1),
+        /* .mem_buffer = */ nullptr,
+        /* .no_alloc   = */ true,
+    };
+    ggml_context *ggml = ggml_init(init);
+    if (!ggml) {
+        return false;
+    }
+
+    gguf_context *gguf = gguf_init_empty();
+
+    gguf_set_val_str(gguf, "general.architecture", "BERT");
+    gguf_set_val_str(gguf, "general.name", s.name);
+    gguf_set_val_u32(gguf, "general.alignment", (uint32_t)gguf_get_alignment(gguf));
+    gguf_set_val_u32(gguf, "general.file_type", 0); // f32
+
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_BERT_TYPE, BERTS_TYPE_BERT);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_VOCAB_SIZE, s.vocab_size);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_HIDDEN_DIM, s.hidden_dim);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_N_LAYERS, s.n_layers);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_ATTN_HEADS, s.attn_heads);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_MAX_TOKENS, s.max_tokens);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_INTERMEDIATE_DIM, s.intermediate_dim);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_HIDDEN_ACT, 0); // GeLU
+    gguf_set_val_f64(gguf, BERTS_KEY_HPARAM_LN_EPS, 1e-12);
+    gguf_set_val_u32(gguf, BERTS_KEY_HPARAM_SEGM_COUNT, s.segment_count);
+    gguf_set_val_f64(gguf, BERTS_KEY_HPARAM_INIT_RANGE, 0.02);
+
+    gguf_set_val_u32(gguf, BERTS_KEY_TOKENIZER_PAD_ID, 0);
+    gguf_set_val_u32(gguf, BERTS_KEY_TOKENIZER_UNK_ID, 1);
+    gguf_set_val_u32(gguf, BERTS_KEY_TOKENIZER_CLS_ID, 2);
+    gguf_set_val_u32(gguf, BERTS_KEY_TOKENIZER_SEP_ID, 3);
+    gguf_set_val_u32(gguf, BERTS_KEY_TOKENIZER_MASK_ID, 4);
+    gguf_set_val_bool(gguf, BERTS_KEY_TOKENIZER_DO_LOWER_CASE, true);
+
+    for (const auto &e : entries) {
+        const bool is_vocab = e.init == entry::VOCAB_SIZE || e.init == entry::VOCAB_DATA;
+        const ggml_type type = is_vocab ? GGML_TYPE_I8 : GGML_TYPE_F32;
+        ggml_tensor *t = e.ne1 == 0
+                             ? ggml_new_tensor_1d(ggml, type, e.ne0)
+                             : ggml_new_tensor_2d(ggml, type, e.ne0, e.ne1);
+        ggml_set_name(t, e.name.c_str());
+        gguf_add_tensor(gguf, t);
+    }
+
+    //
+    // write tensor data, then metadata
+    //
+
+    std::ofstream out{path, std::ios::binary};
+    const size_t meta_size = gguf_get_meta_size(gguf);
+    const size_t alignment = gguf_get_alignment(gguf);
+    const std::vector<char> zeros(std::max(meta_size, alignment), 0);
+
+    out.write(zeros.data(), meta_size);
+
+    // weights ~ U(-0.04, 0.04), roughly the scale of initializer_range = 0.02
+    std::mt19937 rng{42};
+    std::uniform_real_distribution<float> dist{-0.04f, 0.04f};
+    std::vector<float> buf{};
+
+    for (const auto &e : entries) {
+        const size_t n = (size_t)e.ne0 * (size_t)std::max<int64_t>(e.ne1, 1);
+        const char *data;
+        size_t size;
+
+        switch (e.init) {
+        case entry::VOCAB_SIZE:
+            data = (const char *)vocab_size.data();
+            size = vocab_size.size();
+            break;
+        case entry::VOCAB_DATA:
+            data = (const char *)vocab_data.data();
+            size = vocab_data.size();
+            break;
+        default:
+            buf.resize(n);
+            if (e.init == entry::RANDOM) {
+                std::generate(buf.begin(), buf.end(), [&]() { return dist(rng); });
+            } else {
+                std::fill(buf.begin(), buf.end(), e.init == entry::ONES ? 1.0f : 0.0f);
+            }
+            data = (const char *)buf.data();
+            size = n * sizeof(float);
+            break;
+        }
+
+        out.write(data, size);
+        out.write(zeros.data(), GGML_PAD(size, alignment) - size);
+    }
+
+    std::vector<char> meta(meta_size);
+    gguf_get_meta_data(gguf, meta.data());
+    out.seekp(0, std::ios::beg);
+    out.write(meta.data(), meta_size);
+
+    const bool ok = out.good();
+    out.close();
+
+    gguf_free(gguf);
+    ggml_free(ggml);
+
+    return ok;
+}
+
+//
+// weight types
+//
+
+struct weight_type {
+    const char *name;
+    ggml_type type;
+};
+
+static constexpr std::array<weight_type, 13> weight_types{{
+    {"f32", GGML_TYPE_F32},
+    {"f16", GGML_TYPE_F16},
+    {"q4_0", GGML_TYPE_Q4_0},
+    {"q4_1", GGML_TYPE_Q4_1},
+    {"q5_0", GGML_TYPE_Q5_0},
+    {"q5_1", GGML_TYPE_Q5_1},
+    {"q8_0", GGML_TYPE_Q8_0},
+    {"q8_1", GGML_TYPE_Q8_1},
+    {"q2_k", GGML_TYPE_Q2_K},
+    {"q3_k", GGML_TYPE_Q3_K},
+    {"q4_k", GGML_TYPE_Q4_K},
+    {"q5_k", GGML_TYPE_Q5_K},
+    {"q6_k", GGML_TYPE_Q6_K},
+}};
+
+static const weight_type *parse_weight_type(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](char c) { return (char)std::tolower(c); });
+    for (const auto &t : weight_types) {
+        if (s == t.name) {
+            return &t;
+        }
+    }
+    return nullptr;
+}
+
+//
+// configurations
+//
+
+static const char *pool_names[] = {"none", "cls", "avg", "max"};
+
+static bool parse_pool(const std::string &s, berts_pool_type &pool) {
+    for (size_t i = 0; i < std::size(pool_names); ++i) {
+        if (s == pool_names[i]) {
+            pool = (berts_pool_type)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static std::vector<std::string> split(const std::string &s) {
+    std::vector<std::string> result{};
+    size_t p = 0;
+    while (p <= s.size()) {
+        size_t q = s.find(',', p);
+        if (q == std::string::npos) q = s.size();
+        if (p < q) result.push_back(s.substr(p, q - p));
+        p = q + 1;
+    }
+    return result;
+}
+
+static bool parse_ints(const std::string &s, std::vector<int64_t> &out) {
+    out.clear();
+    for (const auto &item : split(s)) {
+        try {
+            size_t rest = 0;
+            out.push_back(std::stoll(item, &rest));
+            if (rest != item.size()) return false;
+        } catch (std::exception &) {
+            return false;
+        }
+    }
+    return !out.empty();
+}
+
+struct model_source {
+    std::string label; // shape name or given path
+    std::string path;
+    bool generated;
+};
+
+struct result {
+    std::string model;
+    std::string weight_type;
+    size_t tokens;
+    int threads;
+    const char *pool;
+    int64_t output_layer;
+    size_t layers;
+    size_t reps;
+    // medians, microseconds
+    double graph_us;
+    double plan_us;
+    double compute_us;
+    double output_us;
+    double total_us;
+    double flops;
+    size_t graph_size;
+    size_t work_size;
+    size_t scratch_peak;
+};
+
+static double per_second(double amount, double us) {
+    return us <= 0 ? 0.0 : amount / (us * 1e-6);
+}
+
+static double median(std::vector<double> xs) {
+    std::sort(xs.begin(), xs.end());
+    const size_t n = xs.size();
+    return n == 0 ? 0.0 : (n % 2 == 1 ? xs[n / 2] : (xs[n / 2 - 1] + xs[n / 2]) / 2);
+}
+
+static bool bench(berts_context *ctx,
+                  const shape &s,
+                  size_t n_tokens,
+                  int n_threads,
+                  berts_pool_type pool,
+                  int64_t output_layer,
+                  size_t reps,
+                  result &r) {
+    // [CLS] random tokens [SEP]
+    std::mt19937 rng{(uint32_t)n_tokens};
+    std::vector<bert_token_t> tokens(n_tokens);
+    for (auto &t : tokens) {
+        t = (bert_token_t)(rng() % s.vocab_size);
+    }
+    tokens.front() = berts_cls_id(ctx);
+    tokens.back() = berts_sep_id(ctx);
+
+    berts_eval_timings timings{};
+    berts_eval_info cond{};
+    berts_init_eval_info(&cond);
+    cond.output_layer = output_layer;
+    cond.pool_type = pool;
+    cond.n_threads = n_threads;
+
+    size_t out_count = 0;
+    if (!berts_eval(ctx, tokens.data(), nullptr, n_tokens, &cond, nullptr, &out_count)) {
+        return false;
+    }
+    std::vector<float> out(out_count);
+
+    // warm up
+    if (!berts_eval(ctx, tokens.data(), nullptr, n_tokens, &cond, out.data(), &out_count)) {
+        return false;
+    }
+
+    cond.timings = &timings;
+    std::vector<double> graph_us, plan_us, compute_us, output_us, total_us;
+    for (size_t i = 0; i < reps; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        if (!berts_eval(ctx, tokens.data(), nullptr, n_tokens, &cond, out.data(), &out_count)) {
+            return false;
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        graph_us.push_back((double)timings.graph_us);
+        plan_us.push_back((double)timings.plan_us);
+        compute_us.push_back((double)timings.compute_us);
+        output_us.push_back((double)timings.output_us);
+        total_us.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+    }
+
+    berts_memory_stats mem{};
+    berts_memory_usage(ctx, &mem);
+
+    const int64_t n_layers = s.n_layers;
+    const size_t layers = (size_t)(output_layer < 0 ? output_layer + n_layers + 1 : output_layer);
+
+    r.tokens = n_tokens;
+    r.threads = n_threads;
+    r.pool = pool_names[pool];
+    r.output_layer = output_layer;
+    r.layers = layers;
+    r.reps = reps;
+    r.graph_us = median(graph_us);
+    r.plan_us = median(plan_us);
+    r.compute_us = median(compute_us);
+    r.output_us = median(output_us);
+    r.total_us = median(total_us);
+    r.flops = encoder_flops(s, n_tokens, layers);
+    r.graph_size = timings.graph_size;
+    r.work_size = timings.work_size;
+    r.scratch_peak = mem.scratch_peak;
+    return true;
+}
+
+//
+// output
+//
+
+static std::string json_string(const std::string &s) {
+    std::string out{"\""};
+    for (const char c : s) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        default:
+            if ((unsigned char)c < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)c);
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+    return out;
+}
+
+static std::string csv_string(const std::string &s) {
+    if (s.find_first_of(",\"\n") == std::string::npos) {
+        return s;
+    }
+    std::string out{"\""};
+    for (const char c : s) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    out += '"';
+    return out;
+}
+
+static void write_json(FILE *fp, size_t reps, const std::vector<result> &results) {
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"benchmark\": \"eval\",\n");
+    fprintf(fp, "  \"version\": %s,\n", json_string(berts_version()).c_str());
+    fprintf(fp, "  \"repetitions\": %zu,\n", reps);
+    fprintf(fp, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &r = results[i];
+        fprintf(fp,
+                "    {\"model\": %s, \"weight_type\": \"%s\", \"tokens\": %zu, \"threads\": %d, "
+                "\"pool\": \"%s\", \"output_layer\": %lld, \"layers\": %zu, "
+                "\"graph_us\": %.1f, \"plan_us\": %.1f, \"compute_us\": %.1f, \"output_us\": %.1f, \"total_us\": %.1f, "
+                "\"tokens_per_s\": %.1f, \"gflop\": %.4f, \"gflop_per_s\": %.2f, "
+                "\"graph_bytes\": %zu, \"work_bytes\": %zu, \"scratch_peak_bytes\": %zu}%s\n",
+                json_string(r.model).c_str(), r.weight_type.c_str(), r.tokens, r.threads,
+                r.pool, (long long)r.output_layer, r.layers,
+                r.graph_us, r.plan_us, r.compute_us, r.output_us, r.total_us,
+                per_second((double)r.tokens, r.total_us), r.flops * 1e-9, per_second(r.flops * 1e-9, r.compute_us),
+                r.graph_size, r.work_size, r.scratch_peak,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+}
+
+static void write_csv(FILE *fp, const std::vector<result> &results) {
+    fprintf(fp,
+            "model,weight_type,tokens,threads,pool,output_layer,layers,"
+            "graph_us,plan_us,compute_us,output_us,total_us,"
+            "tokens_per_s,gflop,gflop_per_s,graph_bytes,work_bytes,scratch_peak_bytes\n");
+    for (const auto &r : results) {
+        fprintf(fp, "%s,%s,%zu,%d,%s,%lld,%zu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.4f,%.2f,%zu,%zu,%zu\n",
+                csv_string(r.model).c_str(), r.weight_type.c_str(), r.tokens, r.threads,
+                r.pool, (long long)r.output_layer, r.layers,
+                r.graph_us, r.plan_us, r.compute_us, r.output_us, r.total_us,
+                per_second((double)r.tokens, r.total_us), r.flops * 1e-9, per_second(r.flops * 1e-9, r.compute_us),
+                r.graph_size, r.work_size, r.scratch_peak);
+    }
+}
+
+int main(int argc, char **argv) {
+    std::cerr << "* berts.cpp v" << berts_version() << " bench_eval" << std::endl;
+
+    berts_set_log_level(BERTS_LOG_WARN);
+
+    //
+    // parse arguments
+    //
+
+    std::vector<model_source> sources{};
+    std::vector<const weight_type *> types{};
+    std::vector<int64_t> token_counts{8, 16, 32, 64, 128, 256, 512};
+    std::vector<int64_t> thread_counts{1};
+    std::vector<berts_pool_type> pools{BERTS_POOL_CLS};
+    std::vector<int64_t> layers{-1};
+    size_t reps = 5;
+    std::string format = "json";
+    const char *out_path = nullptr;
+    std::filesystem::path work_dir = std::filesystem::temp_directory_path();
+
+    if (const auto hw = (int64_t)std::thread::hardware_concurrency(); 1 < hw) {
+        thread_counts.push_back(hw);
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+
+        if (!arg.starts_with("-")) {
+            sources.push_back(model_source{arg, arg, false});
+            continue;
+        }
+
+        if (i + 1 == argc) {
+            show_usage(argv[0]);
+            return 1;
+        }
+        const std::string val{argv[++i]};
+
+        bool ok = true;
+        std::vector<int64_t> ints{};
+        if (arg == "--synth") {
+            const auto it = std::find_if(shapes.begin(), shapes.end(), [&](const shape &s) {
+                return val == s.name || "bert-" + val == s.name;
+            });
+            ok = it != shapes.end();
+            if (ok) sources.push_back(model_source{it->name, "", true});
+        } else if (arg == "-q") {
+            types.clear();
+            for (const auto &item : split(val)) {
+                const auto t = parse_weight_type(item);
+                ok = ok && t;
+                types.push_back(t);
+            }
+        } else if (arg == "-n") {
+            ok = parse_ints(val, token_counts) && std::ranges::all_of(token_counts, [](int64_t n) { return 2 <= n; });
+        } else if (arg == "-t") {
+            ok = parse_ints(val, thread_counts) && std::ranges::all_of(thread_counts, [](int64_t n) { return 1 <= n; });
+        } else if (arg == "-p") {
+            pools.clear();
+            for (const auto &item : split(val)) {
+                berts_pool_type pool = BERTS_POOL_CLS;
+                ok = ok && parse_pool(item, pool);
+                if (!ok) break;
+                pools.push_back(pool);
+            }
+            ok = ok && !pools.empty();
+        } else if (arg == "-l") {
+            ok = parse_ints(val, layers);
+        } else if (arg == "-r") {
+            ok = parse_ints(val, ints) && ints.size() == 1 && 1 <= ints[0];
+            if (ok) reps = (size_t)ints[0];
+        } else if (arg == "-f") {
+            ok = val == "json" || val == "csv";
+            format = val;
+        } else if (arg == "-o") {
+            out_path = argv[i];
+        } else if (arg == "-w") {
+            work_dir = val;
+        } else {
+            show_usage(argv[0]);
+            return 1;
+        }
+
+        if (!ok) {
+            std::cerr << "invalid value for " << arg << ": " << val << std::endl;
+            return 1;
+        }
+    }
+
+    if (sources.empty()) {
+        show_usage(argv[0]);
+        return 1;
+    }
+
+    if (types.empty()) {
+        // as stored
+        types.push_back(nullptr);
+    }
+
+    //
+    // run
+    //
+
+    std::vector<result> results{};
+    std::vector<std::filesystem::path> generated{};
+
+    auto cleanup = [&generated]() {
+        for (const auto &p : generated) {
+            std::error_code e;
+            std::filesystem::remove(p, e);
+        }
+    };
+
+    for (auto &src : sources) {
+        if (src.generated) {
+            const auto path = work_dir / ("berts_bench_" + src.label + "-f32.gguf");
+            std::cerr << "synthesizing " << src.label << " -> " << path.string() << std::endl;
+            if (!synthesize(*std::find_if(shapes.begin(), shapes.end(), [&](const shape &s) { return src.label == s.name; }), path.string())) {
+                std::cerr << "fail to write model: " << path.string() << std::endl;
+                cleanup();
+                return 1;
+            }
+            src.path = path.string();
+            generated.push_back(path);
+        }
+
+        shape s{};
+        if (!read_shape(src.path, s)) {
+            std::cerr << "fail to read hparams: " << src.path << std::endl;
+            cleanup();
+            return 1;
+        }
+
+        for (const auto type : types) {
+            std::string path = src.path;
+            std::string type_name = "stored";
+
+            if (type) {
+                type_name = type->name;
+                const auto stem = std::filesystem::path{src.path}.stem().string();
+                const auto qpath = work_dir / ("berts_bench_" + stem + "-" + type->name + ".gguf");
+                std::cerr << "quantizing " << src.label << " to " << type->name << std::endl;
+                if (!berts_model_quantize(src.path.c_str(), qpath.string().c_str(), type->type)) {
+                    std::cerr << "fail to quantize model: " << src.path << std::endl;
+                    cleanup();
+                    return 1;
+                }
+                path = qpath.string();
+                generated.push_back(qpath);
+            }
+
+            berts_context *ctx = berts_load_from_file(path.c_str());
+            if (!ctx) {
+                std::cerr << "fail to load model: " << path << std::endl;
+                cleanup();
+                return 1;
+            }
+
+            for (const auto n : token_counts) {
+                if ((int64_t)s.max_tokens < n) {
+                    continue;
+                }
+                for (const auto t : thread_counts) {
+                    for (const auto pool : pools) {
+                        for (const auto layer : layers) {
+                            if (layer < -(int64_t)s.n_layers || (int64_t)s.n_layers < layer) {
+                                continue;
+                            }
+
+                            result r{};
+                            r.model = src.label;
+                            r.weight_type = type_name;
+                            if (!bench(ctx, s, (size_t)n, (int)t, pool, layer, reps, r)) {
+                                std::cerr << "fail to evaluate: " << src.label << std::endl;
+                                berts_free(ctx);
+                                cleanup();
+                                return 1;
+                            }
+
+                            fprintf(stderr, "  %-12s %-6s n=%-4zu t=%-3d %-4s l=%-3lld  graph %8.0f  plan %6.0f  compute %10.0f  output %6.0f us  %9.1f tok/s  %7.2f GFLOP/s\n",
+                                    r.model.c_str(), r.weight_type.c_str(), r.tokens, r.threads, r.pool, (long long)r.output_layer,
+                                    r.graph_us, r.plan_us, r.compute_us, r.output_us,
+                                    per_second((double)r.tokens, r.total_us), per_second(r.flops * 1e-9, r.compute_us));
+
+                            results.push_back(std::move(r));
+                        }
+                    }
+                }
+            }
+
+            berts_free(ctx);
+        }
+    }
+
+    cleanup();
+
+    //
+    // output
+    //
+
+    FILE *fp = stdout;
+    if (out_path) {
+        fp = fopen(out_path, "w");
+        if (!fp) {
+            std::cerr << "fail to open file: " << out_path << std::endl;
+            return 1;
+        }
+    }
+
+    if (format == "csv") {
+        write_csv(fp, results);
+    } else {
+        write_json(fp, reps, results);
+    }
+
+    if (fp != stdout) {
+        fclose(fp);
+    }
+
+    return 0;
+}
@@ -0,0 +1,502 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "berts/berts.h"
+#include "berts/tests/alloc_counter.hpp"
+
+//
+// tokenizer throughput benchmark
+//
+// runs `berts_tokenize_into` over a synthetic corpus generated from a fixed seed,
+// so the results are comparable between versions.
+//
+
+static void show_usage(const char *exe) {
+    printf("usage: %s [options] model.gguf [model.gguf ...]\n", exe);
+    printf("\n");
+    printf("options:\n");
+    printf("  -t N     threads of multi-threaded mode (default: hardware concurrency)\n");
+    printf("  -i N     timed passes over the corpus (default: 5)\n");
+    printf("  -n N     documents per corpus (default: 64)\n");
+    printf("  -o PATH  write JSON to PATH (default: stdout)\n");
+    printf("\n");
+}
+
+//
+// corpus
+//
+
+struct corpus {
+    const char *name;
+    std::vector<std::string> docs;
+    size_t bytes;
+};
+
+static void append_utf8(std::string &s, char32_t c) {
+    if (c < 0x80) {
+        s += (char)c;
+    } else if (c < 0x800) {
+        s += (char)(0xc0 | (c >> 6));
+        s += (char)(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+        s += (char)(0xe0 | (c >> 12));
+        s += (char)(0x80 | ((c >> 6) & 0x3f));
+        s += (char)(0x80 | (c & 0x3f));
+    } else {
+        s += (char)(0xf0 | (c >> 18));
+        s += (char)(0x80 | ((c >> 12) & 0x3f));
+        s += (char)(0x80 | ((c >> 6) & 0x3f));
+        s += (char)(0x80 | (c & 0x3f));
+    }
+}
+
+static const char *ascii_words[] = {
+    "the", "of", "and", "to", "in", "is", "was", "for", "that", "with",
+    "model", "language", "representation", "transformer", "attention", "layer",
+    "Hello", "World", "New", "York", "University", "research", "performance",
+    "tokenization", "benchmark", "throughput", "latency", "isn't", "we'll",
+    "2024", "3.14", "42", "(see", "below)", "e.g.", "U.S.", "state-of-the-art",
+};
+
+static const char *latin_words[] = {
+    "café", "naïve", "résumé", "façade", "élève", "señor", "mañana", "Straße",
+    "Übermäßig", "Ångström", "crème", "brûlée", "déjà", "vu", "Zürich", "São",
+    "Paulo", "Łódź", "Kraków", "smörgåsbord", "über", "coöperate", "piñata",
+    "Dvořák", "Ærø", "fjörður", "garçon", "œuvre", "and", "the", "de", "la",
+};
+
+static const char *emoji_words[] = {
+    "great", "job", "lol", "see", "you", "soon", "love", "it", "party", "time",
+};
+
+static const char32_t emoji_chars[] = {
+    0x1f600, 0x1f602, 0x1f60d, 0x1f44d, 0x1f389, 0x2764, 0x1f525, 0x1f680,
+    0x1f914, 0x1f62d, 0x2728, 0x1f64f, 0x1f4af, 0x1f60a, 0x1f973, 0x1f308,
+};
+
+template <typename Gen>
+static corpus make_corpus(const char *name, size_t n_docs, std::mt19937 &rng, Gen &&gen) {
+    corpus c{name, {}, 0};
+    c.docs.reserve(n_docs);
+    for (size_t i = 0; i < n_docs; ++i) {
+        // 32..1024 words (or units) per document
+        const size_t n = 32u << (i % 6);
+        std::string doc{};
+        gen(doc, n, rng);
+        c.bytes += doc.size();
+        c.docs.push_back(std::move(doc));
+    }
+    return c;
+}
+
+template <size_t N>
+static const char *pick(const char *const (&words)[N], std::mt19937 &rng) {
+    return words[rng() % N];
+}
+
+static std::vector<corpus> make_corpora(size_t n_docs) {
+    std::mt19937 rng{20240101};
+    std::vector<corpus> corpora{};
+
+    corpora.push_back(make_corpus("ascii", n_docs, rng, [](std::string &doc, size_t n, std::mt19937 &rng) {
+        for (size_t i = 0; i < n; ++i) {
+            doc += pick(ascii_words, rng);
+            doc += (rng() % 12 == 0) ? ". " : " ";
+        }
+    }));
+
+    corpora.push_back(make_corpus("latin", n_docs, rng, [](std::string &doc, size_t n, std::mt19937 &rng) {
+        for (size_t i = 0; i < n; ++i) {
+            doc += pick(latin_words, rng);
+            doc += (rng() % 10 == 0) ? ", " : " ";
+        }
+    }));
+
+    corpora.push_back(make_corpus("cjk", n_docs, rng, [](std::string &doc, size_t n, std::mt19937 &rng) {
+        for (size_t i = 0; i < n; ++i) {
+            // a phrase of kanji, kana and hangul
+            const size_t len = 2 + rng() % 6;
+            for (size_t k = 0; k < len; ++k) {
+                switch (rng() % 4) {
+                case 0: append_utf8(doc, 0x4e00 + rng() % 0x5200); break; // CJK unified ideographs
+                case 1: append_utf8(doc, 0x3041 + rng() % 0x56); break;   // hiragana
+                case 2: append_utf8(doc, 0x30a1 + rng() % 0x5a); break;   // katakana
+                default: append_utf8(doc, 0xac00 + rng() % 0x2ba4); break; // hangul syllables
+                }
+            }
+            append_utf8(doc, (rng() % 8 == 0) ? U'。' : U'、');
+        }
+    }));
+
+    corpora.push_back(make_corpus("emoji", n_docs, rng, [](std::string &doc, size_t n, std::mt19937 &rng) {
+        for (size_t i = 0; i < n; ++i) {
+            if (rng() % 2 == 0) {
+                doc += pick(emoji_words, rng);
+            } else {
+                const size_t len = 1 + rng() % 3;
+                for (size_t k = 0; k < len; ++k) {
+                    append_utf8(doc, emoji_chars[rng() % std::size(emoji_chars)]);
+                    if (rng() % 8 == 0) {
+                        // ZWJ sequence
+                        append_utf8(doc, 0x200d);
+                        append_utf8(doc, emoji_chars[rng() % std::size(emoji_chars)]);
+                    }
+                }
+            }
+            doc += ' ';
+        }
+    }));
+
+    corpora.push_back(make_corpus("url", n_docs, rng, [](std::string &doc, size_t n, std::mt19937 &rng) {
+        static const char *alnum = "abcdefghijklmnopqrstuvwxyz0123456789";
+        for (size_t i = 0; i < n / 8 + 1; ++i) {
+            doc += "https://www.example.com";
+            const size_t depth = 2 + rng() % 6;
+            for (size_t k = 0; k < depth; ++k) {
+                doc += '/';
+                doc += pick(ascii_words, rng);
+                doc += '_';
+                doc += std::to_string(rng() % 100000);
+            }
+            doc += "?id=";
+            for (size_t k = 0; k < 32; ++k) {
+                doc += alnum[rng() % 36];
+            }
+            doc += "&utm_source=newsletter&ref=";
+            doc += std::to_string(rng());
+            doc += ' ';
+        }
+    }));
+
+    corpora.push_back(make_corpus("long_word", n_docs, rng, [](std::string &doc, size_t n, std::mt19937 &rng) {
+        for (size_t i = 0; i < n / 16 + 1; ++i) {
+            // 50..500 letters without spaces
+            const size_t len = 50 + rng() % 451;
+            for (size_t k = 0; k < len; ++k) {
+                doc += (char)('a' + rng() % 26);
+            }
+            doc += ' ';
+        }
+    }));
+
+    return corpora;
+}
+
+//
+// measurement
+//
+
+using bench_clock = std::chrono::steady_clock;
+
+struct result {
+    std::string model;
+    const char *tokenizer;
+    const char *corpus;
+    const char *mode;
+    size_t threads;
+    size_t calls;
+    size_t bytes;
+    size_t tokens;
+    double seconds;
+    size_t allocs;
+    double p50_us;
+    double p99_us;
+};
+
+struct worker_state {
+    std::vector<bert_token_t> out;
+    std::vector<double> latencies;
+    size_t tokens = 0;
+    size_t bytes = 0;
+    bool ok = true;
+};
+
+static bool tokenize_all(const berts_context *ctx, const corpus &c, worker_state &w, bool record) {
+    for (const auto &doc : c.docs) {
+        // tokens never outnumber bytes
+        size_t len = w.out.size();
+        const auto t0 = bench_clock::now();
+        const bool ok = berts_tokenize_into(ctx, doc.data(), doc.size(), nullptr, w.out.data(), nullptr, &len);
+        const auto t1 = bench_clock::now();
+        if (!ok) {
+            w.ok = false;
+            return false;
+        }
+        if (record) {
+            w.latencies.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+            w.tokens += len;
+            w.bytes += doc.size();
+        }
+    }
+    return true;
+}
+
+static double percentile(std::vector<double> &xs, double p) {
+    if (xs.empty()) {
+        return 0.0;
+    }
+    const size_t k = std::min(xs.size() - 1, (size_t)(p * (double)(xs.size() - 1) + 0.5));
+    std::nth_element(xs.begin(), xs.begin() + k, xs.end());
+    return xs[k];
+}
+
+static bool run(const berts_context *ctx, const corpus &c, size_t n_threads, size_t n_iter, result &r) {
+    size_t max_len = 0;
+    for (const auto &doc : c.docs) {
+        max_len = std::max(max_len, doc.size());
+    }
+
+    std::vector<worker_state> workers(n_threads);
+    for (auto &w : workers) {
+        w.out.resize(max_len + 2);
+        w.latencies.reserve(c.docs.size() * n_iter);
+    }
+
+    std::atomic<bool> start{false};
+    auto work = [&](worker_state &w) {
+        // warm up the per-thread buffers and the word cache
+        if (!tokenize_all(ctx, c, w, false)) {
+            return;
+        }
+        while (!start.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < n_iter; ++i) {
+            if (!tokenize_all(ctx, c, w, true)) {
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 1; i < n_threads; ++i) {
+        threads.emplace_back(work, std::ref(workers[i]));
+    }
+
+    // warm up the main thread before the clock starts
+    if (!tokenize_all(ctx, c, workers[0], false)) {
+        start.store(true, std::memory_order_release);
+        for (auto &t : threads) t.join();
+        return false;
+    }
+
+    const size_t allocs0 = berts::tests::alloc_count();
+    const auto t0 = bench_clock::now();
+    start.store(true, std::memory_order_release);
+    work(workers[0]);
+    for (auto &t : threads) {
+        t.join();
+    }
+    const auto t1 = bench_clock::now();
+    const size_t allocs1 = berts::tests::alloc_count();
+
+    std::vector<double> latencies{};
+    r.tokens = 0;
+    r.bytes = 0;
+    for (auto &w : workers) {
+        if (!w.ok) {
+            return false;
+        }
+        r.tokens += w.tokens;
+        r.bytes += w.bytes;
+        latencies.insert(latencies.end(), w.latencies.begin(), w.latencies.end());
+    }
+
+    r.corpus = c.name;
+    r.mode = n_threads == 1 ? "single" : "multi";
+    r.threads = n_threads;
+    r.calls = latencies.size();
+    r.seconds = std::chrono::duration<double>(t1 - t0).count();
+    r.allocs = allocs1 - allocs0;
+    r.p50_us = percentile(latencies, 0.50);
+    r.p99_us = percentile(latencies, 0.99);
+    return true;
+}
+
+//
+// output
+//
+
+static std::string json_string(const std::string &s) {
+    std::string out{"\""};
+    for (const char c : s) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        default:
+            if ((unsigned char)c < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", (unsigned)c);
+                out += buf;
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+    return out;
+}
+
+static void write_json(FILE *fp, const std::vector<corpus> &corpora, size_t n_iter, const std::vector<result> &results) {
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"benchmark\": \"tokenize\",\n");
+    fprintf(fp, "  \"version\": %s,\n", json_string(berts_version()).c_str());
+    fprintf(fp, "  \"iterations\": %zu,\n", n_iter);
+
+    fprintf(fp, "  \"corpora\": [\n");
+    for (size_t i = 0; i < corpora.size(); ++i) {
+        const auto &c = corpora[i];
+        fprintf(fp, "    {\"name\": \"%s\", \"docs\": %zu, \"bytes\": %zu}%s\n",
+                c.name, c.docs.size(), c.bytes, i + 1 < corpora.size() ? "," : "");
+    }
+    fprintf(fp, "  ],\n");
+
+    fprintf(fp, "  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &r = results[i];
+        fprintf(fp,
+                "    {\"model\": %s, \"tokenizer\": \"%s\", \"corpus\": \"%s\", \"mode\": \"%s\", \"threads\": %zu, "
+                "\"calls\": %zu, \"bytes\": %zu, \"tokens\": %zu, \"seconds\": %.6f, "
+                "\"mb_per_s\": %.3f, \"tokens_per_s\": %.1f, \"allocs_per_call\": %.3f, "
+                "\"p50_us\": %.3f, \"p99_us\": %.3f}%s\n",
+                json_string(r.model).c_str(), r.tokenizer, r.corpus, r.mode, r.threads,
+                r.calls, r.bytes, r.tokens, r.seconds,
+                (double)r.bytes / r.seconds / 1e6, (double)r.tokens / r.seconds, (double)r.allocs / (double)r.calls,
+                r.p50_us, r.p99_us, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(fp, "  ]\n");
+    fprintf(fp, "}\n");
+}
+
+static bool parse_size(const char *s, size_t &v) {
+    try {
+        size_t rest = 0;
+        const long long n = std::stoll(s, &rest);
+        if (rest != std::strlen(s) || n <= 0) {
+            return false;
+        }
+        v = (size_t)n;
+        return true;
+    } catch (std::exception &) {
+        return false;
+    }
+}
+
+int main(int argc, char **argv) {
+    std::cerr << "* berts.cpp v" << berts_version() << " bench_tokenize" << std::endl;
+
+    berts_set_log_level(BERTS_LOG_WARN);
+
+    //
+    // parse arguments
+    //
+
+    size_t n_threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t n_iter = 5;
+    size_t n_docs = 64;
+    const char *out_path = nullptr;
+    std::vector<const char *> model_paths{};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        if (arg == "-t" || arg == "-i" || arg == "-n" || arg == "-o") {
+            if (i + 1 == argc) {
+                show_usage(argv[0]);
+                return 1;
+            }
+            const char *val = argv[++i];
+            bool ok = true;
+            if (arg == "-t") ok = parse_size(val, n_threads);
+            if (arg == "-i") ok = parse_size(val, n_iter);
+            if (arg == "-n") ok = parse_size(val, n_docs);
+            if (arg == "-o") out_path = val;
+            if (!ok) {
+                std::cerr << "invalid value for " << arg << ": " << val << std::endl;
+                return 1;
+            }
+        } else if (arg.starts_with("-")) {
+            show_usage(argv[0]);
+            return 1;
+        } else {
+            model_paths.push_back(argv[i]);
+        }
+    }
+
+    if (model_paths.empty()) {
+        show_usage(argv[0]);
+        return 1;
+    }
+
+    const auto corpora = make_corpora(n_docs);
+
+    //
+    // run
+    //
+
+    std::vector<result> results{};
+
+    for (const char *model_path : model_paths) {
+        berts_context *ctx = berts_load_from_file(model_path);
+        if (!ctx) {
+            std::cerr << "fail to load model: " << model_path << std::endl;
+            return 1;
+        }
+
+        const char *tokenizer = berts_arch(ctx) == BERTS_TYPE_ROBERTA ? "bpe" : "wordpiece";
+
+        for (const auto &c : corpora) {
+            std::vector<size_t> thread_counts{1};
+            if (n_threads > 1) {
+                thread_counts.push_back(n_threads);
+            }
+
+            for (const size_t t : thread_counts) {
+                result r{};
+                r.model = model_path;
+                r.tokenizer = tokenizer;
+                if (!run(ctx, c, t, n_iter, r)) {
+                    std::cerr << "fail to tokenize corpus: " << c.name << std::endl;
+                    berts_free(ctx);
+                    return 1;
+                }
+
+                fprintf(stderr, "  %-9s %-10s %-6s x%-3zu %9.2f MB/s %12.0f tok/s %8.3f alloc/call  p50 %9.2f us  p99 %9.2f us\n",
+                        tokenizer, r.corpus, r.mode, r.threads,
+                        (double)r.bytes / r.seconds / 1e6, (double)r.tokens / r.seconds,
+                        (double)r.allocs / (double)r.calls, r.p50_us, r.p99_us);
+
+                results.push_back(std::move(r));
+            }
+        }
+
+        berts_free(ctx);
+    }
+
+    //
+    // output
+    //
+
+    FILE *fp = stdout;
+    if (out_path) {
+        fp = fopen(out_path, "w");
+        if (!fp) {
+            std::cerr << "fail to open file: " << out_path << std::endl;
+            return 1;
+        }
+    }
+
+    write_json(fp, corpora, n_iter, results);
+
+    if (fp != stdout) {
+        fclose(fp);
+    }
+
+    return 0;
+}
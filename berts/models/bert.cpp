@@ -2,13 +2,15 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <ranges>
-#include <unordered_map>
-#include <unordered_set>
+#include <span>
+#include <string_view>
 #include "berts/models/gguf.hpp"
 #include "berts/models/keys.h"
+#include "berts/models/parallel.hpp"
 #include "berts/models/unicode.hpp"
 #include "berts/models/utils.hpp"
 
@@ -19,6 +21,9 @@ using trie_t = berts::trie::trie;
 
 namespace berts::bert {
 
+// prefix of WordPiece tokens which continue a word
+static constexpr std::string_view continuing_prefix = "##";
+
 //
 // vocab
 //
@@ -63,21 +68,72 @@ vocab::vocab()
 
 vocab::vocab(size_t n)
     : vocab() {
-    id_to_token_.reserve(n);
-    token_to_id_.reserve(n);
+    reserve(n);
 }
 
 vocab::~vocab() = default;
 
 bool vocab::build_trie() {
-    trie.reset(trie::build_trie(id_to_token_));
-    return trie && id_to_token_.size();
+    wordpiece.clear();
+    cache.clear();
+    trie.reset(trie::build_trie(tokens_));
+    if (!trie || !token_count()) {
+        return false;
+    }
+
+    if (!wordpiece.build(trie.get(), continuing_prefix)) {
+        log::error("corrupted vocab: \"##\" is not found");
+        return false;
+    }
+
+    return true;
+}
+
+bool vocab::build_special_tokens(std::span<const bert_token_t> never_split_ids) {
+    std::vector<token_matcher::entry> tokens{};
+    for (const auto id : {special.cls, special.mask, special.pad, special.sep, special.unk}) {
+        if (id != BERTS_INVALID_TOKEN_ID) {
+            tokens.emplace_back(id_to_token(id), id);
+        }
+    }
+    if (!special_matcher.build(tokens)) {
+        return false;
+    }
+
+    tokens.clear();
+    for (const auto id : never_split_ids) {
+        const auto token = id_to_token(id);
+        if (token.empty()) {
+            log::warn("never_split: unknown token id {}; ignored", id);
+            continue;
+        }
+        tokens.emplace_back(token, id);
+    }
+    return never_split.build(tokens);
 }
 
 void vocab::clear() {
-    id_to_token_.clear();
-    token_to_id_.clear();
+    inherited::clear();
+    wordpiece.clear();
+    cache.clear();
     trie.reset();
+    special_matcher.clear();
+    never_split.clear();
+}
+
+size_t vocab::memory_size() const noexcept {
+    return inherited::memory_size() +
+           trie::trie_memory_size(trie.get()) +
+           wordpiece.memory_size() +
+           cache.memory_size() +
+           special_matcher.memory_size() +
+           never_split.memory_size();
+}
+
+size_t vocab::estimate_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) noexcept {
+    return inherited::estimate_memory_size(n_tokens, n_bytes, n_merges) +
+           trie::estimate_trie_memory_size(n_bytes) +
+           wordpiece::wordpiece::estimate_memory_size(n_bytes);
 }
 
 bert_token_t vocab::cls_id() const noexcept {
@@ -142,7 +198,7 @@ bool vocab::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
 
     auto do_lower_case = gguf::gguf_bool(gguf, BERTS_KEY_TOKENIZER_DO_LOWER_CASE, true);
     auto do_basic_tokenize = gguf::gguf_bool(gguf, BERTS_KEY_TOKENIZER_DO_BASIC_TOKENIZE, true);
-    // BERTS_KEY_TOKENIZER_NEVER_SPLIT
+    auto never_split_ids = gguf::token_ids(gguf, BERTS_KEY_TOKENIZER_NEVER_SPLIT);
     auto tokenize_chinese_chars = gguf::gguf_bool(gguf, BERTS_KEY_TOKENIZER_CHINESE_CHARS, true);
     auto strip_accent = gguf::gguf_bool(gguf, BERTS_KEY_TOKENIZER_STRIP_ACCENT, do_lower_case);
 
@@ -203,6 +259,12 @@ bool vocab::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
         return false;
     }
 
+    if (!build_special_tokens(never_split_ids)) {
+        log::error("fail to build special tokens");
+        clear();
+        return false;
+    }
+
     return true;
 }
 
@@ -374,185 +436,330 @@ bool weights::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
 // but we treat them as whitespace here.
 #define BERTS_UNICODE_IS_WS(c) ((c == ' ' || c == '\t' || c == '\n' || c == '\r') || uni::is_whitespace(c))
 #define BERTS_UNICODE_IS_CTRL(c) (c != ' ' && c != '\t' && c != '\n' && c != '\r' && uni::is_control(c))
-#define BERTS_UNICODE_IS_CJK(c) ((c >= 0x4E00 && c <= 0x9FFF) || (c >= 0x3400 && c <= 0x4DBF) || (c >= 0x20000 && c <= 0x2A6DF) || (c >= 0x2A700 && c <= 0x2B73F) || (c >= 0x2B740 && c <= 0x2B81F) || (c >= 0x2B820 && c <= 0x2CEAF) || (c >= 0xF900 && c <= 0xFAFF) || (c >= 0x2F800 && c <= 0x2FA1F))
-// ^ from transformers.BasicTokenizer._is_chinese_char
+#define BERTS_UNICODE_IS_CJK(c) (uni::is_cjk(c))
+// ^ transformers.BasicTokenizer._is_chinese_char
+
+// classification of ASCII bytes, same as the macros above
+enum ascii_class : uint8_t {
+    ASCII_WS = 1 << 0,
+    ASCII_CTRL = 1 << 1,
+    ASCII_PUNCT = 1 << 2,
+    ASCII_UPPER = 1 << 3,
+};
+
+static constexpr auto ascii_table = []() {
+    std::array<uint8_t, 128> table{};
+    for (int c = 0; c < 128; ++c) {
+        uint8_t k = 0;
+        if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            k |= ASCII_WS;
+        } else if (c < 0x20 || c == 0x7f) {
+            k |= ASCII_CTRL;
+        }
+        if ((c >= 33 && c <= 47) || (c >= 58 && c <= 64) || (c >= 91 && c <= 96) || (c >= 123 && c <= 126)) {
+            k |= ASCII_PUNCT;
+        }
+        if ('A' <= c && c <= 'Z') {
+            k |= ASCII_UPPER;
+        }
+        table[c] = k;
+    }
+    return table;
+}();
+
+namespace {
+
+// words produced by basic_tokenize, stored in one buffer
+struct word_list {
+    std::string buffer;
+    std::vector<std::pair<uint32_t, uint32_t>> spans; // (offset, size)
+    // byte range of each word in the input text, kept if `with_origins` is set
+    // `exact` is set if the word maps byte by byte to its range (only the case may differ)
+    struct origin {
+        berts_token_span range;
+        bool exact;
+    };
+    std::vector<origin> origins;
+    bool with_origins = false;
+
+    size_t size() const noexcept {
+        return spans.size();
+    }
 
-static inline ustr safe_norm_nfc(const ustr &in) {
-    ustr s{};
-    if (!normalize_nfc(in, s)) {
-        s = in;
+    std::string_view operator[](size_t i) const noexcept {
+        return {buffer.data() + spans[i].first, spans[i].second};
     }
-    return s;
+
+    void push(std::string_view word, size_t begin, size_t end, bool exact) {
+        if (word.empty()) return;
+        spans.emplace_back((uint32_t)buffer.size(), (uint32_t)word.size());
+        buffer += word;
+        if (with_origins) {
+            origins.push_back({{begin, end}, exact});
+        }
+    }
+
+    void clear() noexcept {
+        buffer.clear();
+        spans.clear();
+        origins.clear();
+    }
+};
+
+// scratch buffers reused for all words
+struct basic_buffers {
+    std::string nfc;
+    std::string word;
+    std::string lower;
+    std::string nfd;
+    std::string stripped;
+};
+
+// kept per thread and reused by all calls
+struct tokenize_buffers {
+    word_list words;
+    basic_buffers basic;
+};
+
+tokenize_buffers &get_tokenize_buffers() {
+    thread_local tokenize_buffers buffers{};
+    return buffers;
 }
 
-static inline ustr safe_norm_nfd(const ustr &in) {
-    ustr s{};
-    if (!normalize_nfd(in, s)) {
-        s = in;
+} // namespace
+
+// `in` itself is returned if it passes the quick check
+static inline std::string_view safe_norm_nfc(std::string_view in, std::string &buf) {
+    if (uni::is_nfc(in) || !uni::normalize_nfc(in, buf)) {
+        return in;
     }
-    return s;
+    return buf;
 }
 
-static void clean_text_and_split(const ustr &in, std::vector<ustr> &out, const tokenizer_info &cond) {
-    std::vector<ustr::cp> cleaned;
-    cleaned.reserve(in.packsize());
+static inline std::string_view safe_norm_nfd(std::string_view in, std::string &buf) {
+    if (uni::is_nfd(in) || !uni::normalize_nfd(in, buf)) {
+        return in;
+    }
+    return buf;
+}
 
-    in.each_cp(false, [&cleaned, &cond](ustr::cp C) {
-        auto c = C.c;
+// clean text (invalid character removal and whitespace cleanup)
+// and add whitespaces around CJK chars
+// and split words by spaces
+// `fn(word, ascii, begin, end)` is called for each word; [begin, end) is the range of the word in `in`
+// (including removed characters)
+template <typename Fn>
+static void clean_text_and_split(std::string_view in, std::string &word, const tokenizer_info &cond, Fn &&fn) {
+    word.clear();
+    bool ascii = true;
+    size_t begin = 0;
+
+    // the word ends at `end`, and the next one starts at `next`
+    auto flush = [&word, &ascii, &begin, &fn](size_t end, size_t next) {
+        if (!word.empty()) {
+            fn(std::string_view{word}, ascii, begin, end);
+            word.clear();
+        }
+        ascii = true;
+        begin = next;
+    };
 
-        if (c == 0) {
-            if (cond.remove_null_char) {
-                log::info("null character found in text");
+    for (size_t i = 0, n = in.size(); i < n;) {
+        // ASCII fast path
+        for (const size_t end = i + uni::ascii_span(in.substr(i)); i < end; ++i) {
+            const char c = in[i];
+            const auto k = ascii_table[(uint8_t)c];
+
+            if (c == 0) {
+                if (cond.remove_null_char) {
+                    log::info("null character found in text");
+                } else {
+                    word += c;
+                }
+            } else if (k & ASCII_CTRL) {
+                if (!cond.remove_control_char) {
+                    word += c;
+                }
+            } else if (k & ASCII_WS) {
+                if (cond.normalize_whitespaces || c == ' ') {
+                    flush(i, i + 1);
+                } else {
+                    word += c;
+                }
             } else {
-                cleaned.push_back(c);
+                word += c;
             }
-            return;
         }
 
+        if (i == n) {
+            break;
+        }
+
+        const size_t start = i;
+        const auto c = uni::decode_utf8(in, i);
+        const auto bytes = in.substr(start, i - start);
+
         if (c == 0xfffd) {
             if (cond.remove_replacement_char) {
-                log::when(BERTS_LOG_INFO, [&C]() {
-                    std::string msg;
-                    if (C.is_pair()) {
-                        msg = berts::fmt::fmt(
-                            "invalid sequence found: lone {} surrogate {:04x}",
-                            C.hi ? "high" : "low",
-                            C.hi ? (int)C.hi : (int)C.lo);
+                log::when(BERTS_LOG_INFO, [&bytes]() {
+                    if (bytes == "\xef\xbf\xbd") {
+                        log::info("0xfffd found");
                     } else {
-                        msg = "0xfffd found";
+                        log::info("invalid sequence found: {:02x}", (int)(unsigned char)bytes[0]);
                     }
-                    log::info(msg);
                 });
             } else {
-                cleaned.push_back(c);
+                uni::encode_utf8(c, word);
+                ascii = false;
             }
-            return;
+            continue;
         }
 
         if (BERTS_UNICODE_IS_CTRL(c)) {
-            if (cond.remove_control_char) {
-                // do nothing
-            } else {
-                cleaned.push_back(c);
+            if (!cond.remove_control_char) {
+                word += bytes;
+                ascii = false;
             }
-            return;
+            continue;
         }
 
         if (BERTS_UNICODE_IS_WS(c)) {
             if (cond.normalize_whitespaces) {
                 // treat all whitespaces to single space ' ' (U+0020)
-                cleaned.push_back(' ');
+                flush(start, i);
             } else {
-                cleaned.push_back(c);
-            }
-            return;
-        }
-
-        // normal character
-        {
-            bool add_space = BERTS_UNICODE_IS_CJK(c) && cond.add_space_around_cjk_char;
-            if (add_space) cleaned.push_back(' ');
-            cleaned.push_back(C);
-            if (add_space) cleaned.push_back(' ');
-        }
-    });
-
-    // strip
-    std::vector<unic_t> current{};
-    for (auto &&C : cleaned) {
-        if (C.c == ' ') {
-            // split words
-            if (current.empty()) {
-                // proceeding spaces
-                // skipping...
-            } else {
-                out.emplace_back(current);
-                current.clear();
+                word += bytes;
+                ascii = false;
             }
             continue;
         }
 
-        if (C.is_pair()) {
-            current.push_back(C.hi);
-            current.push_back(C.lo);
+        // normal character
+        if (BERTS_UNICODE_IS_CJK(c) && cond.add_space_around_cjk_char) {
+            flush(start, start);
+            word += bytes;
+            ascii = false;
+            flush(i, i);
         } else {
-            current.push_back((unic_t)C.c);
+            word += bytes;
+            ascii = false;
         }
     }
 
-    if (!current.empty()) {
-        out.emplace_back(current);
-    }
+    flush(in.size(), in.size());
 }
 
-static bool basic_tokenize(const std::string &text,
-                           const std::unordered_set<ustr> &never_split,
-                           std::vector<ustr> &result,
-                           const tokenizer_info &cond) {
-    log::debug("start basic_tokenize");
-
-    // NFC normalization
-    ustr s = safe_norm_nfc({text});
-
-    // clean text (invalid character removal and whitespace cleanup)
-    // and add whitespaces around CJK chars
-    // and strip preceeding and trailing spaces
-    // and split words by spaces
-    std::vector<ustr> words{};
-    clean_text_and_split(s, words, cond);
+// basic tokenization of `s`, the NFC of `text[offset:offset + size]`
+// if NFC changed the text (`normalized`), all words get the range of the whole text
+static void basic_tokenize_nfc(std::string_view s,
+                               size_t offset,
+                               size_t size,
+                               bool normalized,
+                               const token_matcher &never_split,
+                               word_list &result,
+                               basic_buffers &buf,
+                               const tokenizer_info &cond) {
+    clean_text_and_split(s, buf.word, cond, [&](std::string_view word, bool ascii, size_t begin, size_t end) {
+        // `piece` is at `at` in `word`; the range is exact only if `word` keeps the original length
+        auto push = [&](std::string_view piece, size_t at) {
+            if (normalized) {
+                result.push(piece, offset, offset + size, false);
+            } else if (word.size() == end - begin) {
+                result.push(piece, offset + begin + at, offset + begin + at + piece.size(), true);
+            } else {
+                result.push(piece, offset + begin, offset + end, false);
+            }
+        };
 
-    for (auto &&word : words) {
-        if (never_split.contains(word)) {
-            result.push_back(word);
-            continue;
+        if (never_split.exact(word) != BERTS_INVALID_TOKEN_ID) {
+            push(word, 0);
+            return;
         }
 
-        if (cond.do_lower_case) {
-            ustr s1{std::move(word)};
-            uni::to_lower(s1, word);
+        // lowercase and strip accents in one pass with the fold table
+        const bool fold = cond.do_lower_case && cond.strip_accents && !ascii;
+        if (fold) {
+            if (uni::lower_strip_accents(word, buf.lower)) {
+                word = buf.lower;
+            }
+        } else if (cond.do_lower_case) {
+            if (ascii) {
+                buf.lower.assign(word);
+                for (auto &c : buf.lower) {
+                    if (ascii_table[(uint8_t)c] & ASCII_UPPER) c += 'a' - 'A';
+                }
+                word = buf.lower;
+            } else if (uni::to_lower(word, buf.lower)) {
+                word = buf.lower;
+                // e.g. U+212A KELVIN SIGN -> 'k'
+                ascii = uni::is_ascii(word);
+            }
         }
 
-        if (cond.strip_accents) {
-            ustr s1 = safe_norm_nfd(word);
-            std::vector<unic32_t> s2{};
-            s1.each_cp(true, [&s2](ustr::cp C) {
-                if (!uni::is_category(C.c, "Mn")) {
-                    s2.push_back(C.c);
+        // ASCII has no accents
+        if (cond.strip_accents && !ascii && !fold) {
+            const auto nfd = safe_norm_nfd(word, buf.nfd);
+
+            buf.stripped.clear();
+            for (size_t i = 0, n = nfd.size(); i < n;) {
+                const size_t start = i;
+                const auto c = uni::decode_utf8(nfd, i);
+                if (!uni::is_nonspacing_mark(c)) {
+                    buf.stripped += nfd.substr(start, i - start);
                 }
-            });
-            word = safe_norm_nfc({s2});
+            }
+
+            // `word` may point to buf.lower, but it is not used anymore
+            word = safe_norm_nfc(buf.stripped, buf.lower);
         }
 
         if (!cond.split_on_punc) {
-            result.push_back(word);
-            continue;
+            push(word, 0);
+            return;
         }
 
         // split at a puctuation
-
-        std::vector<unic32_t> temp{};
-        word.each_cp(true, [&result, &temp](ustr::cp C) {
-            // .ab.cd.
-            if (uni::is_punct(C.c)) {
-                // .ab.cd.
-                // ^  ^  ^
-                if (!temp.empty()) {
-                    // .ab.cd.
-                    //     ~~^-C
-                    //       ` temp
-                    result.emplace_back(temp);
-                    temp.clear();
-                }
-                result.emplace_back(&C.c, 1);
+        // .ab.cd.
+        size_t piece = 0;
+        for (size_t i = 0, n = word.size(); i < n;) {
+            const size_t start = i;
+            bool punct;
+            if ((uint8_t)word[i] < 0x80) {
+                punct = ascii_table[(uint8_t)word[i]] & ASCII_PUNCT;
+                ++i;
             } else {
+                punct = uni::is_punct(uni::decode_utf8(word, i));
+            }
+            if (punct) {
                 // .ab.cd.
-                //  ^^ ^^
-                temp.push_back(C.c);
+                // ^  ^  ^
+                push(word.substr(piece, start - piece), piece);
+                push(word.substr(start, i - start), start);
+                piece = i;
             }
-        });
+        }
+        push(word.substr(piece), piece);
+    });
+}
+
+static bool basic_tokenize(std::string_view text,
+                           const token_matcher &never_split,
+                           word_list &result,
+                           basic_buffers &buf,
+                           const tokenizer_info &cond) {
+    log::debug("start basic_tokenize");
 
-        if (!temp.empty()) {
-            result.emplace_back(temp);
+    if (uni::is_nfc(text)) {
+        basic_tokenize_nfc(text, 0, text.size(), false, never_split, result, buf, cond);
+    } else {
+        // NFC normalization
+        // no character composes with ' ' and ' ' always separates words,
+        // so the runs between spaces are normalized separately to keep the ranges of the other words
+        for (size_t begin = 0, end; begin < text.size(); begin = end + 1) {
+            end = std::min(text.find(' ', begin), text.size());
+            const auto run = text.substr(begin, end - begin);
+            const auto s = safe_norm_nfc(run, buf.nfc);
+            basic_tokenize_nfc(s, begin, run.size(), s != run, never_split, result, buf, cond);
         }
     }
 
@@ -561,41 +768,80 @@ static bool basic_tokenize(const std::string &text,
     return true;
 }
 
+// byte ranges of the pieces of a word; every piece gets the whole range
+// unless the word maps to its range byte by byte and the pieces are found in it as they are
+static void wordpiece_spans(const vocab &vocab,
+                            std::string_view word,
+                            const word_list::origin &origin,
+                            std::span<const bert_token_t> ids,
+                            std::vector<berts_token_span> &spans) {
+    const size_t n0 = spans.size();
+
+    const auto [begin, end] = origin.range;
+
+    bool exact = origin.exact && word.size() == end - begin;
+    size_t pos = 0;
+    for (size_t k = 0; exact && k < ids.size(); ++k) {
+        auto piece = vocab.id_to_token(ids[k]);
+        if (k != 0 && piece.starts_with(continuing_prefix)) {
+            piece.remove_prefix(continuing_prefix.size());
+        }
+        exact = word.substr(pos).starts_with(piece) && !piece.empty();
+        spans.push_back({begin + pos, begin + pos + piece.size()});
+        pos += piece.size();
+    }
+
+    if (!exact || pos != word.size()) {
+        spans.resize(n0);
+        spans.insert(spans.end(), ids.size(), origin.range);
+    }
+}
+
 static bool wordpiece_tokenize(const vocab &vocab,
-                               const std::vector<ustr> &words,
-                               std::vector<bert_token_t> &result) {
+                               const word_list &words,
+                               std::vector<bert_token_t> &result,
+                               std::vector<berts_token_span> *spans) {
     log::debug("start wordpiece_tokenize");
 
-    auto root_node = trie::trie_root(vocab.trie.get());
-    auto cont_node = trie::search_node(vocab.trie.get(), ustr{"##", 2});
-    if (!cont_node) {
-        log::error("corrupted vocab: \"##\" is not found");
+    if (vocab.wordpiece.empty()) {
+        log::error("vocab is not initialized");
         return false;
     }
 
-    auto unk = vocab.special.unk;
-
-    auto root = root_node;
-    for (const auto &word : words) {
-        ustr found{}, rest{word};
-        while (!rest.empty()) {
-            const auto id = trie::search_trie_substr(root, rest, found, rest);
-            if (id != BERTS_INVALID_TOKEN_ID) {
-                // found
-                result.push_back(id);
-                root = rest.empty() ? root_node : cont_node;
-                log::when(BERTS_LOG_DEBUG, [&found, id] {
-                    log::debug("  token: {} ({})", found.encode(), id);
-                });
-            } else {
-                // not found
-                result.push_back(unk);
-                log::when(BERTS_LOG_WARN, [&rest] {
-                    log::warn("  unknown token: {}", rest.encode());
-                });
-                break;
-            }
+    const auto unk = vocab.special.unk;
+
+    for (size_t i = 0, n = words.size(); i < n; ++i) {
+        const auto word = words[i];
+        const size_t n0 = result.size();
+
+        const bool cacheable = vocab.cache.accepts(word);
+        const bool hit = cacheable && vocab.cache.find(word, result);
+
+        const bool ok = hit || vocab.wordpiece.tokenize(word, unk, result);
+        if (cacheable && !hit) {
+            vocab.cache.insert(word, std::span{result}.subspan(n0));
+        }
+
+        if (spans) {
+            wordpiece_spans(vocab, word, words.origins[i], std::span{result}.subspan(n0), *spans);
+        }
+
+        if (hit) {
+            continue;
         }
+
+        if (!ok) {
+            log::when(BERTS_LOG_WARN, [word] {
+                log::warn("  unknown token: {}", word);
+            });
+            continue;
+        }
+
+        log::when(BERTS_LOG_DEBUG, [&vocab, &result, n0] {
+            for (size_t i = n0; i < result.size(); ++i) {
+                log::debug("  token: {} ({})", vocab.id_to_token(result[i]), result[i]);
+            }
+        });
     }
 
     log::debug("end wordpiece_tokenize");
@@ -604,41 +850,103 @@ static bool wordpiece_tokenize(const vocab &vocab,
 }
 
 static bool tokenize(const vocab &vocab,
-                     const std::string &text,
-                     const std::unordered_set<std::string> &never_split,
-                     std::vector<bert_token_t> &result) {
+                     std::string_view text,
+                     std::vector<bert_token_t> &result,
+                     std::vector<berts_token_span> *spans) {
     log::info("start tokenize");
 
-    // usually never_split is small, so
-    // i expect this does not cause
-    // performance issue :)
-    std::unordered_set<ustr> keep{};
-    for (const auto &word : never_split) {
-        keep.emplace(word);
-    }
+    auto &buffers = get_tokenize_buffers();
+    auto &words = buffers.words;
+    words.with_origins = spans != nullptr;
 
-    std::vector<ustr> split_tokens{};
-    basic_tokenize(text, keep, split_tokens, vocab.cond);
+    // "a[MASK]b" -> "a", "[MASK]", "b" (same as transformers)
+    const bool ok = vocab.special_matcher.split(text, [&](std::string_view piece, bert_token_t id) {
+        const size_t offset = piece.data() - text.data();
 
-    wordpiece_tokenize(vocab, split_tokens, result);
+        if (id != BERTS_INVALID_TOKEN_ID) {
+            result.push_back(id);
+            if (spans) spans->push_back({offset, offset + piece.size()});
+            return true;
+        }
+
+        const size_t n0 = spans ? spans->size() : 0;
+
+        words.clear();
+        basic_tokenize(piece, vocab.never_split, words, buffers.basic, vocab.cond);
+        if (!wordpiece_tokenize(vocab, words, result, spans)) {
+            return false;
+        }
+
+        // ranges in `piece` -> ranges in `text`
+        if (spans) {
+            for (size_t i = n0; i < spans->size(); ++i) {
+                (*spans)[i].begin += offset;
+                (*spans)[i].end += offset;
+            }
+        }
+        return true;
+    });
 
     log::info("end tokenize");
 
-    return true;
+    return ok;
 }
 
-bool model::tokenize(const berts_context *ctx, const std::string &text, std::vector<bert_token_t> &out) const {
+// texts shorter than this are tokenized on one thread
+static constexpr size_t min_chunk_size = 64 * 1024;
+
+bool model::tokenize(const berts_context *ctx,
+                     std::string_view text,
+                     std::vector<bert_token_t> &out,
+                     std::vector<berts_token_span> *spans,
+                     int n_threads) const {
     (void)ctx;
 
-    std::string cls = vocab->cls_token();
-    std::string mask = vocab->mask_token();
-    std::string pad = vocab->pad_token();
-    std::string sep = vocab->sep_token();
-    std::string unk = vocab->unk_token();
+    const size_t n_chunks = n_threads <= 0 ? GGML_DEFAULT_N_THREADS : n_threads;
+    if (n_chunks == 1 || text.size() < 2 * min_chunk_size) {
+        return bert::tokenize(*vocab, text, out, spans);
+    }
+
+    // ' ' is a normalization boundary and always separates words,
+    // so each chunk is tokenized independently with the same result
+    const auto chunks = parallel::split_chunks(
+        text,
+        n_chunks,
+        min_chunk_size,
+        [](std::string_view s, size_t i) { return s[i] == ' '; });
+
+    if (chunks.size() == 1) {
+        return bert::tokenize(*vocab, text, out, spans);
+    }
 
-    std::unordered_set<std::string> never_split{cls, mask, pad, sep, unk};
+    std::vector<std::vector<bert_token_t>> results(chunks.size());
+    std::vector<std::vector<berts_token_span>> span_results(spans ? chunks.size() : 0);
+    std::atomic_bool ok{true};
+    parallel::parallel_for(chunks.size(), chunks.size(), [&](size_t i) {
+        if (!bert::tokenize(*vocab, chunks[i], results[i], spans ? &span_results[i] : nullptr)) {
+            ok = false;
+        }
+    });
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        out.insert(out.end(), results[i].begin(), results[i].end());
+        if (spans) {
+            const size_t offset = chunks[i].data() - text.data();
+            for (const auto &span : span_results[i]) {
+                spans->push_back({span.begin + offset, span.end + offset});
+            }
+        }
+    }
+
+    return ok;
+}
 
-    return bert::tokenize(*vocab, text, never_split, out);
+void model::tokenizer_cache_stats(berts_tokenizer_cache_stats &stats) const noexcept {
+    const auto s = vocab->cache.get_stats();
+    stats.hits = s.hits;
+    stats.misses = s.misses;
+    stats.entries = s.entries;
+    stats.capacity = s.capacity;
 }
 
 //
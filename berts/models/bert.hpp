@@ -1,9 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 #include "berts/models/model_berts.hpp"
+#include "berts/models/token_matcher.hpp"
 #include "berts/models/trie.hpp"
+#include "berts/models/word_cache.hpp"
+#include "berts/models/wordpiece.hpp"
 
 // std::unique_resource<trie::trie>
 namespace std {
@@ -60,6 +64,13 @@ struct vocab : public internal::vocab_base2<vocab> {
     tokenizer_info cond;
     special_tokens special;
     std::unique_ptr<berts::trie::trie> trie;
+    berts::wordpiece::wordpiece wordpiece;
+    // normalized word -> token ids; shared by all contexts and threads
+    berts::word_cache cache;
+    // split from the text before basic tokenization, even inside a word
+    berts::token_matcher special_matcher;
+    // words which basic tokenization keeps as they are (BERTS_KEY_TOKENIZER_NEVER_SPLIT)
+    berts::token_matcher never_split;
 
     vocab();
     vocab(size_t n);
@@ -68,6 +79,9 @@ struct vocab : public internal::vocab_base2<vocab> {
 
     bool build_trie();
 
+    /// @brief build `special_matcher` from `special` and `never_split` from the given ids
+    bool build_special_tokens(std::span<const bert_token_t> never_split_ids);
+
     bert_token_t cls_id() const noexcept;
     bert_token_t mask_id() const noexcept;
     bert_token_t pad_id() const noexcept;
@@ -79,6 +93,10 @@ struct vocab : public internal::vocab_base2<vocab> {
     bool init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf);
 
     void clear();
+
+    size_t memory_size() const noexcept;
+
+    static size_t estimate_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) noexcept;
 };
 
 static_assert(internal::Vocab<vocab>);
@@ -146,8 +164,12 @@ struct model : public internal::model_berts<vocab, weights> {
     }
 
     bool tokenize(const berts_context *ctx,
-                  const std::string &text,
-                  std::vector<bert_token_t> &out) const override;
+                  std::string_view text,
+                  std::vector<bert_token_t> &out,
+                  std::vector<berts_token_span> *spans,
+                  int n_threads) const override;
+
+    void tokenizer_cache_stats(berts_tokenizer_cache_stats &stats) const noexcept override;
 
     internal::ggml_size_info get_context_buffer_size(
         size_t token_count,
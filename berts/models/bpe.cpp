@@ -1,14 +1,13 @@
 #include "berts/models/bpe.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cassert>
 #include <compare>
 #include <iterator>
-#include <queue>
 #include <random>
 #include <ranges>
 #include <sstream>
-#include <type_traits>
 #include "berts/models/log.hpp"
 
 //
@@ -32,7 +31,7 @@ struct symbol_t {
 };
 
 struct word_t {
-    std::vector<symbol_t> symbols;
+    std::vector<symbol_t> &symbols;
 
     void add(bert_token_t id, uint32_t cp_len) {
         if (symbols.empty()) {
@@ -73,11 +72,31 @@ struct merge_t {
     }
 };
 
+// working buffers reused across words
+struct scratch_t {
+    std::vector<symbol_t> symbols;
+    // binary heap of merge_t (std::push_heap/std::pop_heap)
+    std::vector<merge_t> queue;
+    std::vector<merge_t> skip;
+};
+
+static scratch_t &get_scratch() {
+    thread_local scratch_t scratch{};
+    return scratch;
+}
+
+// [0, 1); only used with dropout
+static double uniform_random() {
+    thread_local std::default_random_engine e{std::random_device{}()};
+    thread_local std::uniform_real_distribution<> rand{0.0, 1.0};
+    return rand(e);
+}
+
 static bool tokenize_bpe(const bpe &bpe, const bpe::str_t &text, bpe::tokenized_t &result, bpe::cache_t *cache);
 
-static bool merge_all(const bpe &bpe, word_t &word);
+static bool merge_all(const bpe &bpe, word_t &word, scratch_t &scratch);
 
-static bool merge_word(const bpe &bpe, const bpe::str_t &text, word_t &result);
+static bool merge_word(const bpe &bpe, const bpe::str_t &text, word_t &result, scratch_t &scratch);
 
 static bool word_to_tokens(const bpe &bpe, const word_t &word, std::vector<token_t> &result);
 
@@ -91,72 +110,149 @@ static inline void reserve(T &container, size_t n) {
     container.reserve(container.size() + n);
 }
 
-static inline bpe::str_t slice(const bpe::str_t &str, size_t begin = 0, int32_t len = -1) {
-    std::vector<unicode::unic32_t> codepoints{};
-    size_t index = 0;
-    str.each_cp(false, [&](const bpe::str_t::cp &cp) {
-        if (index++ < begin) {
-            return;
-        }
-        if (len < 0 || codepoints.size() < (size_t)len) {
-            codepoints.push_back(cp.c);
+// length in code units of the code point at `str[i]`
+static inline size_t cp_size(unicode::ustr_view str, size_t i) noexcept {
+    const bool high = 0xd800 <= str[i] && str[i] < 0xdc00;
+    const bool low = i + 1 < str.size() && 0xdc00 <= str[i + 1] && str[i + 1] < 0xe000;
+    return high && low ? 2 : 1;
+}
+
+// [begin, begin + len) in code points of `str`, without copying
+static inline unicode::ustr_view slice(unicode::ustr_view str, size_t begin = 0, int32_t len = -1) {
+    auto advance = [&str](size_t i, size_t n) {
+        for (; n != 0 && i < str.size(); --n) {
+            i += cp_size(str, i);
         }
-    });
-    return {codepoints};
+        return i;
+    };
+    const size_t first = advance(0, begin);
+    const size_t last = len < 0 ? str.size() : advance(first, (size_t)len);
+    return str.substr(first, last - first);
 }
 
 bpe::bpe(str_t unk, double dropout, bool fuse_unk)
     : unk(unk)
+    , unk_id_(BERTS_INVALID_TOKEN_ID)
     , dropout_(dropout)
     , fuse_unk_(fuse_unk)
+    , own_vocab()
+    , ref_vocab(nullptr)
     , continueing_subword_prefix_("")
     , end_of_word_suffix_("") {}
 
 void bpe::clear() {
-    vocab.clear();
+    own_vocab.clear();
+    ref_vocab = nullptr;
     merge.clear();
+    unk_id_ = BERTS_INVALID_TOKEN_ID;
 }
 
-bool bpe::id_to_token(bert_token_t id, str_t &token) const {
-    auto it = vocab_r.find(id);
-    if (it == vocab_r.end()) {
-        return false;
+//
+// merge_map
+//
+
+void merge_map::reserve(size_t n) {
+    // keep load factor <= 0.5
+    if (slots_.size() < n * 2) {
+        rehash(std::bit_ceil(n * 2));
     }
-    token = it->second;
-    return true;
 }
 
-bool bpe::token_to_id(const str_t &token, bert_token_t &id) const {
-    auto it = vocab.find(token);
-    if (it == vocab.end()) {
+void merge_map::clear() {
+    slots_.clear();
+    count_ = 0;
+}
+
+void merge_map::insert_or_assign(bert_token_t id0, bert_token_t id1, value_type value) {
+    const uint64_t key = pack(id0, id1);
+    if (key == empty_key) {
+        return;
+    }
+
+    if (slots_.size() < (count_ + 1) * 2) {
+        rehash(std::max<size_t>(16, slots_.size() * 2));
+    }
+
+    const size_t mask = slots_.size() - 1;
+    size_t i = hash::mix64(key) & mask;
+    while (slots_[i].key != empty_key && slots_[i].key != key) {
+        i = (i + 1) & mask;
+    }
+    if (slots_[i].key == empty_key) {
+        slots_[i].key = key;
+        ++count_;
+    }
+    slots_[i].value = value;
+}
+
+size_t merge_map::memory_size() const noexcept {
+    return slots_.capacity() * sizeof(slot_t);
+}
+
+size_t merge_map::estimate_memory_size(size_t n) noexcept {
+    return std::max<size_t>(16, std::bit_ceil(n * 2)) * sizeof(slot_t);
+}
+
+void merge_map::rehash(size_t capacity) {
+    std::vector<slot_t> slots(capacity, slot_t{empty_key, {}});
+    const size_t mask = capacity - 1;
+    for (const auto &slot : slots_) {
+        if (slot.key == empty_key) {
+            continue;
+        }
+        size_t i = hash::mix64(slot.key) & mask;
+        while (slots[i].key != empty_key) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = slot;
+    }
+    slots_ = std::move(slots);
+}
+
+//
+// bpe
+//
+
+size_t bpe::memory_size() const noexcept {
+    return own_vocab.memory_size() + merge.memory_size();
+}
+
+size_t bpe::estimate_memory_size(size_t n_merges) noexcept {
+    return merge_map::estimate_memory_size(n_merges);
+}
+
+bool bpe::id_to_token(bert_token_t id, str_t &token) const {
+    const auto str = vocab().at(id);
+    if (str.empty()) {
         return false;
     }
-    id = it->second;
+    token = str_t{str};
     return true;
 }
 
-bool bpe::load_vocab(const vocab_t &vocab, const std::vector<token_id_pair> &merge) {
+bool bpe::token_to_id(unicode::ustr_view token, bert_token_t &id) const {
+    // short tokens fit in the small string buffer
+    std::string buf{};
+    token.encode_to(buf);
+    id = vocab().find(buf);
+    return id != BERTS_INVALID_TOKEN_ID;
+}
+
+bool bpe::load_vocab(const flat_vocab &vocab, const std::vector<token_id_pair> &merge) {
     log::debug("loading BPE vocab");
 
-    reserve(this->vocab, vocab.size());
-    reserve(this->vocab_r, vocab.size());
-    reserve(this->merge, merge.size());
+    ref_vocab = &vocab == &own_vocab ? nullptr : &vocab;
+    this->merge.reserve(this->merge.size() + merge.size());
 
-    // unordered_map::merge does not receive "const" argument.
-    for (const auto &[str, id] : vocab) {
-        this->vocab.insert_or_assign(str, id);
-        this->vocab_r.insert_or_assign(id, str);
+    unk_id_ = BERTS_INVALID_TOKEN_ID;
+    if (!unk.empty()) {
+        token_to_id(unk, unk_id_);
     }
-    
-    //log::when(BERTS_LOG_DEBUG, [this, &vocab]() {
+
+    //log::when(BERTS_LOG_DEBUG, [&vocab]() {
     //    log::debug("  vocab");
-    //    std::vector<bert_token_t> ids{};
-    //    for (const auto &[str, id] : vocab) {
-    //        ids.push_back(id);
-    //    }
-    //    std::sort(ids.begin(), ids.end());
-    //    for (auto &&id : ids) {
-    //        log::debug("    {:>3}: {}", id, this->vocab_r[id].encode());
+    //    for (size_t id = 0; id < vocab.size(); ++id) {
+    //        log::debug("    {:>3}: {}", id, vocab.at(id));
     //    }
     //});
 
@@ -190,7 +286,7 @@ bool bpe::load_vocab(const vocab_t &vocab, const std::vector<token_id_pair> &mer
             return false;
         }
 
-        this->merge.insert_or_assign(pair, std::pair{rank, new_token_id});
+        this->merge.insert_or_assign(id0, id1, {(uint32_t)rank, new_token_id});
         //log::debug("    rank={}, [{}({}), {}({})] -> {}({})", rank, token0.encode(), id0, token1.encode(), id1, new_token.encode(), new_token_id);
     }
 
@@ -199,6 +295,27 @@ bool bpe::load_vocab(const vocab_t &vocab, const std::vector<token_id_pair> &mer
     return true;
 }
 
+bool bpe::load_vocab(const vocab_t &vocab, const std::vector<token_id_pair> &merge) {
+    // copy tokens in id order
+    std::vector<std::pair<bert_token_t, std::string>> tokens{};
+    tokens.reserve(vocab.size());
+    for (const auto &[str, id] : vocab) {
+        tokens.emplace_back(id, str.encode());
+    }
+    std::sort(tokens.begin(), tokens.end());
+
+    own_vocab.clear();
+    own_vocab.reserve(tokens.size());
+    for (const auto &[id, token] : tokens) {
+        if (!own_vocab.insert(id, token)) {
+            log::error("token {} ({}) is duplicated in vocab", token, id);
+            return false;
+        }
+    }
+
+    return load_vocab(own_vocab, merge);
+}
+
 bool bpe::load_vocab(const vocab_t &vocab, const std::vector<token_pair> &merge) {
     std::vector<token_id_pair> merge_{};
     for (const auto &[token0, token1] : merge) {
@@ -230,6 +347,35 @@ bool bpe::tokenize(const str_t &text, tokenized_t &result, cache_t &cache) const
     return tokenize_bpe(*this, text, result, &cache);
 }
 
+bool bpe::tokenize(std::span<const bert_token_t> symbols, std::vector<bert_token_t> &out) const {
+    if (symbols.empty()) return true;
+
+    auto &scratch = get_scratch();
+    scratch.symbols.clear();
+    word_t word{scratch.symbols};
+
+    for (const auto id : symbols) {
+        if (id != BERTS_INVALID_TOKEN_ID) {
+            word.add(id, 1);
+        } else if (unk_id_ != BERTS_INVALID_TOKEN_ID) {
+            if (!fuse_unk() || !word.last_is(unk_id_)) {
+                word.add(unk_id_, 1);
+            }
+        }
+    }
+
+    if (!merge_all(*this, word, scratch)) {
+        return false;
+    }
+
+    reserve(out, word.symbols.size());
+    for (const auto &sym : word.symbols) {
+        out.push_back(sym.id);
+    }
+
+    return true;
+}
+
 static bool tokenize_bpe(const bpe &bpe, const bpe::str_t &text, bpe::tokenized_t &result, bpe::cache_t *cache) {
     log::when(BERTS_LOG_DEBUG, [&text]() {
         log::debug("start BPE tokenization");
@@ -251,8 +397,10 @@ static bool tokenize_bpe(const bpe &bpe, const bpe::str_t &text, bpe::tokenized_
         // not found
     }
 
-    word_t word{};
-    if (!merge_word(bpe, text, word)) {
+    auto &scratch = get_scratch();
+    scratch.symbols.clear();
+    word_t word{scratch.symbols};
+    if (!merge_word(bpe, text, word, scratch)) {
         return false;
     }
 
@@ -287,7 +435,7 @@ static bool tokenize_bpe(const bpe &bpe, const bpe::str_t &text, bpe::tokenized_
     return true;
 }
 
-static bool merge_all(const bpe &bpe, word_t &word) {
+static bool merge_all(const bpe &bpe, word_t &word, scratch_t &scratch) {
     log::when(BERTS_LOG_DEBUG, [&word]() {
         std::stringstream ss{};
         ss << "(";
@@ -304,33 +452,34 @@ static bool merge_all(const bpe &bpe, word_t &word) {
     //
     // init priority queue
     //
-    std::priority_queue<merge_t> q{};
-    for (auto const [index, view] : word.symbols | std::views::slide(2) | std::views::enumerate) {
-        // const auto &[sym1, sym2] = view;
-        const symbol_t &sym1 = view[0];
-        const symbol_t &sym2 = view[1];
-        auto it = bpe.merge.find({sym1.id, sym2.id});
-        if (it != bpe.merge.end()) {
-            const auto [rank, new_id] = it->second;
-            q.emplace((size_t)index, rank, new_id);
+    auto &q = scratch.queue;
+    auto &skip = scratch.skip;
+    q.clear();
+    skip.clear();
+
+    auto push = [&q](int32_t index, uint32_t rank, bert_token_t new_id) {
+        q.emplace_back(index, rank, new_id);
+        std::push_heap(q.begin(), q.end());
+    };
+
+    for (size_t index = 0; index + 1 < word.symbols.size(); ++index) {
+        if (const auto m = bpe.merge.find(word.symbols[index].id, word.symbols[index + 1].id)) {
+            q.emplace_back((int32_t)index, m->rank, m->new_id);
         }
     }
-
-    std::random_device seed{};
-    std::default_random_engine e{seed()};
-    std::uniform_real_distribution<> rand{0.0, 1.0};
+    std::make_heap(q.begin(), q.end());
 
     //
     // main
     //
     const auto d = bpe.dropout();
-    std::vector<merge_t> skip;
     while (!q.empty()) {
-        const auto top = q.top();
-        q.pop();
+        std::pop_heap(q.begin(), q.end());
+        const auto top = q.back();
+        q.pop_back();
 
         if (0.0 < d) {
-            if (rand(e) < d) {
+            if (uniform_random() < d) {
                 // skip
                 skip.push_back(top);
                 continue;
@@ -339,7 +488,8 @@ static bool merge_all(const bpe &bpe, word_t &word) {
 
         // Re-insert the skipped elements
         for (auto &&skipped : skip) {
-            q.push(skipped);
+            q.push_back(skipped);
+            std::push_heap(q.begin(), q.end());
         }
         skip.clear();
 
@@ -358,14 +508,12 @@ static bool merge_all(const bpe &bpe, word_t &word) {
         symbol_t &right = word.symbols[next_pos];
 
         // Make sure we are not processing an expired queue entry
-        std::pair target_new_pair{sym.id, right.id};
-        auto target_it = bpe.merge.find(target_new_pair);
-        if (target_it == bpe.merge.end()) {
+        const auto target = bpe.merge.find(sym.id, right.id);
+        if (!target) {
             continue;
         }
 
-        static_assert(std::is_same_v<decltype(target_it->second), std::pair<uint32_t, bert_token_t>>);
-        if (target_it->second.second /* new_id */ != top.new_id) {
+        if (target->new_id != top.new_id) {
             continue;
         }
 
@@ -384,28 +532,16 @@ static bool merge_all(const bpe &bpe, word_t &word) {
         // Insert the new pair formed with the previous symbol
         if (0 <= sym.prev) {
             const symbol_t &prev = word.symbols[sym.prev];
-            std::pair new_pair{prev.id, sym.id};
-            auto prev_it = bpe.merge.find(new_pair);
-            if (prev_it != bpe.merge.end()) {
-                q.emplace(
-                    sym.prev,
-                    prev_it->second.first, // rank
-                    prev_it->second.second // new_id
-                );
+            if (const auto m = bpe.merge.find(prev.id, sym.id)) {
+                push(sym.prev, m->rank, m->new_id);
             }
         }
 
         // Insert the new pair formed with the next symbol
         if ((size_t)sym.next < word.symbols.size()) {
             const symbol_t &next = word.symbols[sym.next];
-            std::pair new_pair{sym.id, next.id};
-            auto next_it = bpe.merge.find(new_pair);
-            if (next_it != bpe.merge.end()) {
-                q.emplace(
-                    top.index,
-                    next_it->second.first, // rank
-                    next_it->second.second // new_id
-                );
+            if (const auto m = bpe.merge.find(sym.id, next.id)) {
+                push(top.index, m->rank, m->new_id);
             }
         }
     }
@@ -421,33 +557,42 @@ static bool merge_all(const bpe &bpe, word_t &word) {
     return true;
 }
 
-static bool merge_word(const bpe &bpe, const bpe::str_t &text, word_t &result) {
-    std::vector<std::pair<bpe::str_t, size_t>> chars{};
-    text.each_cp(false, [&](const berts::unicode::ustr::cp &cp) {
-        chars.push_back({{&cp.c, 1}, 1});
-    });
-
+static bool merge_word(const bpe &bpe, const bpe::str_t &text, word_t &result, scratch_t &scratch) {
     const bpe::str_t &prefix = bpe.continueing_subword_prefix();
     const bpe::str_t &suffix = bpe.end_of_word_suffix();
     const auto prefix_len = prefix.codepoints();
     const auto suffix_len = suffix.codepoints();
 
-    for (size_t i = 0; i < chars.size(); ++i) {
-        if (i != 0) {
-            chars[i].first = bpe.continueing_subword_prefix() + chars[i].first;
-            chars[i].second += prefix_len;
-        }
-        if (i == chars.size() - 1) {
-            chars[i].first += bpe.end_of_word_suffix();
-            chars[i].second += suffix_len;
-        }
-    }
+    // characters are sliced from `text`; a buffer (inline for short symbols) is needed only to add the prefix or the suffix
+    bpe::str_t affixed{};
+
+    const unicode::ustr_view str = text;
+    reserve(result.symbols, str.size());
 
-    reserve(result.symbols, chars.size());
+    for (size_t i = 0, n; i < str.size(); i += n) {
+        n = cp_size(str, i);
+
+        unicode::ustr_view symbol = str.substr(i, n);
+        size_t symbol_len = 1;
+
+        const bool with_prefix = i != 0 && !prefix.empty();
+        const bool with_suffix = i + n == str.size() && !suffix.empty();
+        if (with_prefix || with_suffix) {
+            affixed.clear();
+            if (with_prefix) {
+                affixed += prefix;
+                symbol_len += prefix_len;
+            }
+            affixed += symbol;
+            if (with_suffix) {
+                affixed += suffix;
+                symbol_len += suffix_len;
+            }
+            symbol = affixed;
+        }
 
-    for (const auto &s : chars) {
-        if (bert_token_t id; bpe.token_to_id(s.first, id)) {
-            result.add(id, s.second);
+        if (bert_token_t id; bpe.token_to_id(symbol, id)) {
+            result.add(id, symbol_len);
         } else {
             // TODO byte_fallback
             // if (bpe.byte_fallback) {
@@ -457,7 +602,7 @@ static bool merge_word(const bpe &bpe, const bpe::str_t &text, word_t &result) {
                 if (bert_token_t unk_id; bpe.token_to_id(bpe.unk, unk_id)) {
                     // unk found
                     if (!bpe.fuse_unk() || !result.last_is(unk_id)) {
-                        result.add(unk_id, s.second + bpe.unk.codepoints());
+                        result.add(unk_id, symbol_len + bpe.unk.codepoints());
                         //                 ^~~~~~~~ ???
                     }
                 } else {
@@ -471,7 +616,7 @@ static bool merge_word(const bpe &bpe, const bpe::str_t &text, word_t &result) {
         }
     }
 
-    return merge_all(bpe, result);
+    return merge_all(bpe, result, scratch);
 }
 
 static bool word_to_tokens(const bpe &bpe, const word_t &word, std::vector<token_t> &result) {
@@ -1,42 +1,120 @@
 #pragma once
 
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 #include "berts/berts.h"
+#include "berts/models/flat_vocab.hpp"
+#include "berts/models/hash.hpp"
 #include "berts/models/unicode.hpp"
 
 namespace std {
 template <>
 struct hash<std::pair<bert_token_t, bert_token_t>> {
     size_t operator()(const std::pair<bert_token_t, bert_token_t> &pair) const {
-        using hasher = std::hash<bert_token_t>;
-        return (hasher{}(pair.first)) ^ (hasher{}(pair.second));
+        return berts::hash::pair(pair.first, pair.second);
     }
 };
 } // namespace std
 
 namespace berts {
 
+/**
+ * (id0, id1) -> (rank, new_id) table of BPE merges
+ *
+ * ---
+ * open addressing with linear probing; a pair of ids is packed into one 64-bit key
+ * and stored inline with its value, so a lookup touches one or two cache lines
+ */
+struct merge_map {
+    struct value_type {
+        uint32_t rank;
+        bert_token_t new_id;
+    };
+
+    merge_map() = default;
+
+    size_t size() const noexcept {
+        return count_;
+    }
+
+    bool empty() const noexcept {
+        return count_ == 0;
+    }
+
+    void reserve(size_t n);
+
+    void clear();
+
+    /// @brief insert a merge or overwrite the existing one
+    void insert_or_assign(bert_token_t id0, bert_token_t id1, value_type value);
+
+    /// @return the merge of (id0, id1) or nullptr if not found
+    const value_type *find(bert_token_t id0, bert_token_t id1) const noexcept {
+        if (slots_.empty()) {
+            return nullptr;
+        }
+        const uint64_t key = pack(id0, id1);
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = hash::mix64(key) & mask;; i = (i + 1) & mask) {
+            const auto &slot = slots_[i];
+            if (slot.key == key) {
+                return &slot.value;
+            }
+            if (slot.key == empty_key) {
+                return nullptr;
+            }
+        }
+    }
+
+    /// @brief allocated bytes
+    size_t memory_size() const noexcept;
+
+    /// @brief bytes needed to hold `n` merges
+    static size_t estimate_memory_size(size_t n) noexcept;
+
+  private:
+    struct slot_t {
+        uint64_t key;
+        value_type value;
+    };
+
+    // (BERTS_INVALID_TOKEN_ID, BERTS_INVALID_TOKEN_ID) is never merged
+    static constexpr uint64_t empty_key = ~0ULL;
+
+    static constexpr uint64_t pack(bert_token_t id0, bert_token_t id1) noexcept {
+        return ((uint64_t)id0 << 32) | id1;
+    }
+
+    std::vector<slot_t> slots_;
+    size_t count_ = 0;
+
+    void rehash(size_t capacity);
+};
+
 struct bpe {
     using str_t = unicode::ustr;
     using vocab_t = std::unordered_map<str_t, bert_token_t>;
-    using vocab_r_t = std::unordered_map<bert_token_t, str_t>;
     using tokenized_t = std::vector<str_t>;
     using cache_t = std::unordered_map<str_t, tokenized_t>;
 
     using token_id_pair = std::pair<bert_token_t, bert_token_t>;
     using token_pair = std::pair<str_t, str_t>;
     // (id0, id1) -> (rank, new_id)
-    using mergemap_t = std::unordered_map<token_id_pair, std::pair<uint32_t, bert_token_t>>;
+    using mergemap_t = merge_map;
 
     const str_t unk;
+    // id of `unk` in the vocab; BERTS_INVALID_TOKEN_ID if not found
+    bert_token_t unk_id_;
     double dropout_;
     bool fuse_unk_;
 
-    vocab_t vocab;
-    vocab_r_t vocab_r;
+    // tokens owned by this instance (when loaded from `vocab_t`)
+    flat_vocab own_vocab;
+    // tokens owned by the model's vocab (when loaded from `flat_vocab`)
+    const flat_vocab *ref_vocab;
     mergemap_t merge;
 
     str_t continueing_subword_prefix_;
@@ -76,12 +154,25 @@ struct bpe {
         end_of_word_suffix_ = str;
     }
 
+    const flat_vocab &vocab() const noexcept {
+        return ref_vocab ? *ref_vocab : own_vocab;
+    }
+
     bool id_to_token(bert_token_t id, str_t &token) const;
 
-    bool token_to_id(const str_t &token, bert_token_t &id) const;
+    bool token_to_id(unicode::ustr_view token, bert_token_t &id) const;
 
     void clear();
 
+    /// @brief approximate allocated bytes (excluding the referenced vocab)
+    size_t memory_size() const noexcept;
+
+    /// @brief approximate bytes needed to hold `n_merges` merge rules
+    static size_t estimate_memory_size(size_t n_merges) noexcept;
+
+    /// @brief load vocab without copying tokens; `vocab` must outlive this instance
+    bool load_vocab(const flat_vocab &vocab, const std::vector<token_id_pair> &merge);
+
     bool load_vocab(const vocab_t &vocab, const std::vector<token_id_pair> &merge);
 
     bool load_vocab(const vocab_t &vocab, const std::vector<token_pair> &merge);
@@ -89,6 +180,11 @@ struct bpe {
     bool tokenize(const str_t &text, tokenized_t &result) const;
 
     bool tokenize(const str_t &text, tokenized_t &result, cache_t &cache) const;
+
+    /// @brief tokenize one word given as ids of its initial symbols and append token ids to `out`
+    /// @note `BERTS_INVALID_TOKEN_ID` in `symbols` is replaced with unk;
+    ///       no string is made and working buffers are reused per thread
+    bool tokenize(std::span<const bert_token_t> symbols, std::vector<bert_token_t> &out) const;
 };
 
 } // namespace berts
@@ -167,11 +167,15 @@ def write_bert(w: gguf.GGUFWriter, tokenizer: BertTokenizer, model: BertModel, K
         w.add_bool(K['BERTS_KEY_TOKENIZER_DO_BASIC_TOKENIZE'], do_basic_tokenize)
     if tokenize_chinese_chars is not None:
         w.add_bool(K['BERTS_KEY_TOKENIZER_CHINESE_CHARS'], tokenize_chinese_chars)
-    # never split ???
-    if never_split is not None:
-        if len(never_split) != 0:
-            raise RuntimeError(f'never_split: {never_split}')
-            w.add_bool(K['BERTS_KEY_TOKENIZER_NEVER_SPLIT'], tokenizer.basic_tokenizer.never_split)
+    if never_split is not None and len(never_split) != 0:
+        # stored as token ids; words not in the vocab cannot be kept as one token anyway
+        vocab = tokenizer.get_vocab()
+        unknown = sorted(t for t in never_split if t not in vocab)
+        if len(unknown) != 0:
+            print(f'never_split: not in vocab, ignored: {unknown}')
+        ids = sorted(vocab[t] for t in never_split if t in vocab)
+        if len(ids) != 0:
+            w.add_array(K['BERTS_KEY_TOKENIZER_NEVER_SPLIT'], ids)
     if strip_accents is not None:
         w.add_bool(K['BERTS_KEY_TOKENIZER_STRIP_ACCENT'], strip_accents)
 
@@ -392,6 +396,13 @@ def convert(repo_id: str, cache_dir: str|None, output_path: str):
     total_size_org = 0
     total_size_new = 0
 
+    # tied weights: the LM decoder shares the data of the word embeddings
+    tied_keys = {
+        'predictions.decoder.weight': 'embeddings.word_embeddings.weight',
+    }
+    tie_targets: dict[str, np.ndarray] = dict()
+    aliases: list[str] = []
+
     for key, tensor in model.state_dict().items():
         tensor: np.ndarray = tensor.squeeze().cpu().numpy()
         n_dims = tensor.ndim
@@ -414,6 +425,9 @@ def convert(repo_id: str, cache_dir: str|None, output_path: str):
 
         w.add_tensor('berts.bert.' + key, tensor)
 
+        if key in tied_keys.values():
+            tie_targets[key] = tensor
+
         print(f'''
 {key}:
   quantized = {q}
@@ -462,6 +476,13 @@ def convert(repo_id: str, cache_dir: str|None, output_path: str):
         if key in lm_skip_keys:
             continue
 
+        target = tied_keys.get(key)
+        if target in tie_targets and np.array_equal(tie_targets[target], tensor):
+            total_size_new -= size_new
+            aliases += ['berts.bert.' + key, 'berts.bert.' + target]
+            print(f'{key}: alias of {target}')
+            continue
+
         w.add_tensor('berts.bert.' + key, tensor)
 
         print(f'''
@@ -471,6 +492,9 @@ def convert(repo_id: str, cache_dir: str|None, output_path: str):
   size = {size_org/1024:.1f} KiB -> {size_new/1024:.1f} KiB
 '''.strip())
     
+    if len(aliases) != 0:
+        w.add_array(K['BERTS_KEY_ALL_TENSOR_ALIAS'], aliases)
+
     print(f'''
 {"="*40}
 original size  = {total_size_org/1024/1024:.1f} MiB
@@ -0,0 +1,114 @@
+#include "berts/models/flat_vocab.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include "berts/models/hash.hpp"
+
+namespace berts {
+
+static inline uint64_t hash_token(std::string_view token) noexcept {
+    return hash::string(token);
+}
+
+void flat_vocab::reserve(size_t n, size_t bytes) {
+    offsets_.reserve(n + 1);
+    if (bytes != 0) {
+        pool_.reserve(bytes);
+    }
+    if (table_.size() < n * 2) {
+        rehash(std::bit_ceil(n * 2));
+    }
+}
+
+void flat_vocab::clear() {
+    pool_.clear();
+    offsets_.assign(1, 0);
+    table_.clear();
+    count_ = 0;
+}
+
+bert_token_t flat_vocab::find(std::string_view token) const noexcept {
+    if (table_.empty()) {
+        return BERTS_INVALID_TOKEN_ID;
+    }
+
+    const size_t mask = table_.size() - 1;
+    for (size_t i = hash_token(token) & mask;; i = (i + 1) & mask) {
+        const auto id = table_[i];
+        if (id == BERTS_INVALID_TOKEN_ID) {
+            return BERTS_INVALID_TOKEN_ID;
+        }
+        if (at(id) == token) {
+            return id;
+        }
+    }
+}
+
+bool flat_vocab::add(std::string_view token) {
+    return insert(static_cast<bert_token_t>(size()), token);
+}
+
+bool flat_vocab::insert(bert_token_t id, std::string_view token) {
+    if (id < size() || id == BERTS_INVALID_TOKEN_ID) {
+        return false;
+    }
+
+    if (contains(token)) {
+        return false;
+    }
+
+    // keep load factor <= 0.5
+    if (table_.size() < (count_ + 1) * 2) {
+        rehash(std::max<size_t>(16, table_.size() * 2));
+    }
+
+    // holes
+    while (size() < id) {
+        offsets_.push_back(offsets_.back());
+    }
+
+    pool_.insert(pool_.end(), token.begin(), token.end());
+    offsets_.push_back(static_cast<uint32_t>(pool_.size()));
+
+    const size_t mask = table_.size() - 1;
+    size_t i = hash_token(token) & mask;
+    while (table_[i] != BERTS_INVALID_TOKEN_ID) {
+        i = (i + 1) & mask;
+    }
+    table_[i] = id;
+    ++count_;
+
+    return true;
+}
+
+size_t flat_vocab::memory_size() const noexcept {
+    return pool_.capacity() * sizeof(char) +
+           offsets_.capacity() * sizeof(uint32_t) +
+           table_.capacity() * sizeof(bert_token_t);
+}
+
+size_t flat_vocab::estimate_memory_size(size_t n, size_t bytes) noexcept {
+    const size_t table = std::max<size_t>(16, std::bit_ceil(n * 2));
+    return bytes * sizeof(char) +
+           (n + 1) * sizeof(uint32_t) +
+           table * sizeof(bert_token_t);
+}
+
+void flat_vocab::rehash(size_t capacity) {
+    std::vector<bert_token_t> table(capacity, BERTS_INVALID_TOKEN_ID);
+    const size_t mask = capacity - 1;
+    for (const auto id : table_) {
+        if (id == BERTS_INVALID_TOKEN_ID) {
+            continue;
+        }
+        size_t i = hash_token(at(id)) & mask;
+        while (table[i] != BERTS_INVALID_TOKEN_ID) {
+            i = (i + 1) & mask;
+        }
+        table[i] = id;
+    }
+    table_ = std::move(table);
+}
+
+} // namespace berts
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "berts/berts.h"
+
+namespace berts {
+
+/**
+ * token table backed by a single string pool
+ *
+ * ---
+ * tokens are stored in one contiguous buffer and addressed by offsets,
+ * token -> id lookup is done with an open-addressing hash table (linear probing)
+ * which holds token ids only
+ */
+struct flat_vocab {
+    flat_vocab() = default;
+
+    /// @brief number of token ids (including holes made by `insert`)
+    size_t size() const noexcept {
+        return offsets_.size() - 1;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    void reserve(size_t n, size_t bytes = 0);
+
+    void clear();
+
+    /// @brief get the token of given id
+    /// @return the token or empty string if `id` is out of range
+    std::string_view at(bert_token_t id) const noexcept {
+        if (size() <= id) {
+            return {};
+        }
+        return {pool_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]};
+    }
+
+    /// @return token id or BERTS_INVALID_TOKEN_ID if not found
+    bert_token_t find(std::string_view token) const noexcept;
+
+    bool contains(std::string_view token) const noexcept {
+        return find(token) != BERTS_INVALID_TOKEN_ID;
+    }
+
+    /// @brief append a token with next id
+    /// @return `false` if the token already exists
+    bool add(std::string_view token);
+
+    /// @brief append a token with given id (must be >= size()); skipped ids become holes
+    /// @return `false` if the token already exists or the id is already used
+    bool insert(bert_token_t id, std::string_view token);
+
+    /// @brief allocated bytes
+    size_t memory_size() const noexcept;
+
+    /// @brief bytes needed to hold `n` tokens of `bytes` bytes in total
+    static size_t estimate_memory_size(size_t n, size_t bytes) noexcept;
+
+  private:
+    std::vector<char> pool_;
+    std::vector<uint32_t> offsets_{0};
+    std::vector<bert_token_t> table_;
+    size_t count_ = 0; // tokens in table_
+
+    void rehash(size_t capacity);
+};
+
+} // namespace berts
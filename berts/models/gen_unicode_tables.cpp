@@ -0,0 +1,283 @@
+// generate models/unicode_tables.hpp from ICU character properties
+//
+//   $ make unicode_tables
+//   (or) $ ./gen_unicode_tables > models/unicode_tables.hpp
+//
+// properties are packed into 16 bits per code point and stored as a two-stage table:
+//   stage1[c >> 8] -> block index
+//   stage2[block * 256 + (c & 0xff)] -> flags
+//
+// fold mapping (lowercase -> NFD -> remove Mn -> NFC, root locale, no context) is
+// stored in the same layout; values are offsets into a pool of length-prefixed UTF-8
+// sequences, and 0 means the code point maps to itself
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <icu.h>
+#else
+#include <unicode/uchar.h>
+#include <unicode/unorm2.h>
+#include <unicode/ustring.h>
+#include <unicode/uversion.h>
+#endif
+
+static constexpr int32_t n_codepoints = 0x110000;
+static constexpr int32_t block_bits = 8;
+static constexpr int32_t block_size = 1 << block_bits;
+
+enum : uint16_t {
+    PROP_WHITESPACE = 1 << 0, // '\t' + Zs
+    PROP_CONTROL = 1 << 1,    // C*
+    PROP_PUNCT = 1 << 2,      // P* + ASCII symbols
+    PROP_MN = 1 << 3,         // Mn
+    PROP_CJK = 1 << 4,        // CJK ideographs (transformers.BasicTokenizer._is_chinese_char)
+    PROP_LETTER = 1 << 5,     // L*
+    PROP_NUMBER = 1 << 6,     // N*
+    PROP_NFC_UNSAFE = 1 << 7, // NFC_Quick_Check != Yes or ccc != 0
+    PROP_NFD_UNSAFE = 1 << 8, // NFD_Quick_Check != Yes or ccc != 0
+    PROP_SPACE = 1 << 9,      // White_Space (`\s` of regex)
+};
+
+static bool is_cjk(int32_t c) {
+    return (c >= 0x4E00 && c <= 0x9FFF) ||
+           (c >= 0x3400 && c <= 0x4DBF) ||
+           (c >= 0x20000 && c <= 0x2A6DF) ||
+           (c >= 0x2A700 && c <= 0x2B73F) ||
+           (c >= 0x2B740 && c <= 0x2B81F) ||
+           (c >= 0x2B820 && c <= 0x2CEAF) ||
+           (c >= 0xF900 && c <= 0xFAFF) ||
+           (c >= 0x2F800 && c <= 0x2FA1F);
+}
+
+static uint16_t properties(int32_t c) {
+    uint16_t k = 0;
+
+    if (u_isblank(c)) {
+        k |= PROP_WHITESPACE;
+    }
+
+    if (!u_isprint(c)) {
+        k |= PROP_CONTROL;
+    }
+
+    // according to transformers, we treat all
+    // non-letter/number ASCII as punctuation
+    if ((c >= 33 && c <= 47) ||
+        (c >= 58 && c <= 64) ||
+        (c >= 91 && c <= 96) ||
+        (c >= 123 && c <= 126) ||
+        (U_GET_GC_MASK(c) & U_GC_P_MASK)) {
+        k |= PROP_PUNCT;
+    }
+
+    if (u_charType(c) == U_NON_SPACING_MARK) {
+        k |= PROP_MN;
+    }
+
+    if (is_cjk(c)) {
+        k |= PROP_CJK;
+    }
+
+    if (U_GET_GC_MASK(c) & U_GC_L_MASK) {
+        k |= PROP_LETTER;
+    }
+
+    if (U_GET_GC_MASK(c) & U_GC_N_MASK) {
+        k |= PROP_NUMBER;
+    }
+
+    if (u_getIntPropertyValue(c, UCHAR_NFC_QUICK_CHECK) != UNORM_YES || u_getCombiningClass(c) != 0) {
+        k |= PROP_NFC_UNSAFE;
+    }
+
+    if (u_getIntPropertyValue(c, UCHAR_NFD_QUICK_CHECK) != UNORM_YES || u_getCombiningClass(c) != 0) {
+        k |= PROP_NFD_UNSAFE;
+    }
+
+    if (u_isUWhiteSpace(c)) {
+        k |= PROP_SPACE;
+    }
+
+    return k;
+}
+
+static void check(UErrorCode e) {
+    if (U_FAILURE(e)) {
+        std::fprintf(stderr, "icu error: %s\n", u_errorName(e));
+        std::exit(1);
+    }
+}
+
+static std::u16string normalize(const UNormalizer2 *k, const std::u16string &s) {
+    UChar buf[64];
+    UErrorCode e = U_ZERO_ERROR;
+    const auto len = unorm2_normalize(k, (const UChar *)s.data(), (int32_t)s.size(), buf, 64, &e);
+    check(e);
+    return {(const char16_t *)buf, (size_t)len};
+}
+
+// lowercase -> NFD -> remove Mn -> NFC
+// returns `true` if `c` is mapped to other sequence
+static bool fold(int32_t c, std::string &out) {
+    UErrorCode e = U_ZERO_ERROR;
+    const auto nfd = unorm2_getNFDInstance(&e);
+    check(e);
+    const auto nfc = unorm2_getNFCInstance(&e);
+    check(e);
+
+    UChar src[2];
+    int32_t src_len = 0;
+    U16_APPEND_UNSAFE(src, src_len, c);
+
+    UChar lower[64];
+    const auto lower_len = u_strToLower(lower, 64, src, src_len, "", &e);
+    check(e);
+
+    const auto d = normalize(nfd, {(const char16_t *)lower, (size_t)lower_len});
+
+    std::u16string stripped;
+    for (int32_t i = 0, n = (int32_t)d.size(); i < n;) {
+        UChar32 ch;
+        U16_NEXT(d.data(), i, n, ch);
+        if (u_charType(ch) != U_NON_SPACING_MARK) {
+            UChar tmp[2];
+            int32_t tmp_len = 0;
+            U16_APPEND_UNSAFE(tmp, tmp_len, ch);
+            stripped.append((const char16_t *)tmp, tmp_len);
+        }
+    }
+
+    const auto composed = normalize(nfc, stripped);
+
+    if (composed.size() == (size_t)src_len && std::equal(composed.begin(), composed.end(), src)) {
+        return false;
+    }
+
+    char buf[64];
+    int32_t len = 0;
+    u_strToUTF8(buf, 64, &len, (const UChar *)composed.data(), (int32_t)composed.size(), &e);
+    check(e);
+    out.assign(buf, len);
+    return true;
+}
+
+template <typename T, typename Fn>
+static void make_table(Fn &&value, std::vector<uint16_t> &stage1, std::vector<std::vector<T>> &blocks) {
+    std::map<std::vector<T>, uint16_t> index{};
+    for (int32_t base = 0; base < n_codepoints; base += block_size) {
+        std::vector<T> block(block_size);
+        for (int32_t i = 0; i < block_size; ++i) {
+            block[i] = value(base + i);
+        }
+        auto [it, inserted] = index.emplace(block, (uint16_t)blocks.size());
+        if (inserted) {
+            blocks.push_back(block);
+        }
+        stage1.push_back(it->second);
+    }
+}
+
+template <typename T>
+static void print_array(const char *type, const char *name, const std::vector<T> &values, size_t per_line, const char *format) {
+    std::printf("inline constexpr %s %s[%zu] = {", type, name, values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        std::printf("%s", i % per_line == 0 ? "\n    " : " ");
+        std::printf(format, (unsigned)values[i]);
+        std::printf(",");
+    }
+    std::printf("\n};\n");
+    std::printf("\n");
+}
+
+template <typename T>
+static std::vector<T> flatten(const std::vector<std::vector<T>> &blocks) {
+    std::vector<T> v;
+    for (const auto &block : blocks) {
+        v.insert(v.end(), block.begin(), block.end());
+    }
+    return v;
+}
+
+int main() {
+    //
+    // properties
+    //
+
+    std::vector<uint16_t> prop_stage1{};
+    std::vector<std::vector<uint16_t>> prop_blocks{};
+    make_table<uint16_t>(properties, prop_stage1, prop_blocks);
+
+    //
+    // fold
+    //
+
+    // length-prefixed UTF-8; offset 0 is reserved for identity
+    std::vector<uint8_t> fold_pool{0};
+    std::map<std::string, uint16_t> fold_offsets{};
+
+    auto fold_value = [&fold_pool, &fold_offsets](int32_t c) -> uint16_t {
+        std::string s;
+        if ((0xd800 <= c && c < 0xe000) || !fold(c, s)) {
+            return 0;
+        }
+        auto [it, inserted] = fold_offsets.emplace(s, (uint16_t)fold_pool.size());
+        if (inserted) {
+            fold_pool.push_back((uint8_t)s.size());
+            fold_pool.insert(fold_pool.end(), s.begin(), s.end());
+        }
+        return it->second;
+    };
+
+    std::vector<uint16_t> fold_stage1{};
+    std::vector<std::vector<uint16_t>> fold_blocks{};
+    make_table<uint16_t>(fold_value, fold_stage1, fold_blocks);
+
+    if (255 < prop_blocks.size() || 255 < fold_blocks.size() || 0xffff < fold_pool.size()) {
+        std::fprintf(stderr, "tables are too large\n");
+        return 1;
+    }
+
+    std::printf("// generated by models/gen_unicode_tables.cpp from ICU %s (Unicode %s); do not edit\n", U_ICU_VERSION, U_UNICODE_VERSION);
+    std::printf("\n");
+    std::printf("#pragma once\n");
+    std::printf("\n");
+    std::printf("#include <cstdint>\n");
+    std::printf("\n");
+    std::printf("namespace berts::unicode::tables {\n");
+    std::printf("\n");
+    std::printf("enum : uint16_t {\n");
+    std::printf("    PROP_WHITESPACE = 0x%02x, // '\\t' + Zs\n", PROP_WHITESPACE);
+    std::printf("    PROP_CONTROL = 0x%02x,    // C*\n", PROP_CONTROL);
+    std::printf("    PROP_PUNCT = 0x%02x,      // P* + ASCII symbols\n", PROP_PUNCT);
+    std::printf("    PROP_MN = 0x%02x,         // Mn\n", PROP_MN);
+    std::printf("    PROP_CJK = 0x%02x,        // CJK ideographs\n", PROP_CJK);
+    std::printf("    PROP_LETTER = 0x%02x,     // L*\n", PROP_LETTER);
+    std::printf("    PROP_NUMBER = 0x%02x,     // N*\n", PROP_NUMBER);
+    std::printf("    PROP_NFC_UNSAFE = 0x%02x, // NFC_Quick_Check != Yes or ccc != 0\n", PROP_NFC_UNSAFE);
+    std::printf("    PROP_NFD_UNSAFE = 0x%02x, // NFD_Quick_Check != Yes or ccc != 0\n", PROP_NFD_UNSAFE);
+    std::printf("    PROP_SPACE = 0x%02x,      // White_Space (`\\s` of regex)\n", PROP_SPACE);
+    std::printf("};\n");
+    std::printf("\n");
+    std::printf("inline constexpr int32_t block_bits = %d;\n", block_bits);
+    std::printf("\n");
+
+    std::vector<uint8_t> prop_stage1_u8(prop_stage1.begin(), prop_stage1.end());
+    print_array("uint8_t", "prop_stage1", prop_stage1_u8, 32, "%u");
+    print_array("uint16_t", "prop_stage2", flatten(prop_blocks), 16, "0x%03x");
+
+    std::vector<uint8_t> fold_stage1_u8(fold_stage1.begin(), fold_stage1.end());
+    print_array("uint8_t", "fold_stage1", fold_stage1_u8, 32, "%u");
+    print_array("uint16_t", "fold_stage2", flatten(fold_blocks), 16, "%u");
+    print_array("uint8_t", "fold_pool", fold_pool, 16, "0x%02x");
+
+    std::printf("} // namespace berts::unicode::tables\n");
+
+    return 0;
+}
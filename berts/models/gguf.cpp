@@ -1,12 +1,15 @@
 #include "berts/models/gguf.hpp"
 
+#include <algorithm>
 #include <array>
 #include <fstream>
+#include <memory>
 #include "berts/berts.h"
 #include "berts/models/bert.hpp"
 #include "berts/models/internal.hpp"
 #include "berts/models/keys.h"
 #include "berts/models/log.hpp"
+#include "berts/models/memory.hpp"
 #include "berts/models/roberta.hpp"
 #include "berts/models/utils.hpp"
 
@@ -54,6 +57,54 @@ std::string type_to_str(ggml_type type) {
     return ftype((uint32_t)type);
 }
 
+std::vector<tensor_alias_t> tensor_aliases(const gguf_context *ctx) {
+    std::vector<tensor_alias_t> result;
+
+    const auto key = index(ctx, BERTS_KEY_ALL_TENSOR_ALIAS);
+    if (key < 0) {
+        return result;
+    }
+
+    if (gguf_get_kv_type(ctx, key) != GGUF_TYPE_ARRAY || gguf_get_arr_type(ctx, key) != GGUF_TYPE_STRING) {
+        log::warn("{} must be an array of string; ignored", BERTS_KEY_ALL_TENSOR_ALIAS);
+        return result;
+    }
+
+    const auto n = gguf_get_arr_n(ctx, key);
+    if (n % 2 != 0) {
+        log::warn("{} must have even number of elements; the last one is ignored", BERTS_KEY_ALL_TENSOR_ALIAS);
+    }
+
+    for (int i = 0; i + 1 < n; i += 2) {
+        result.emplace_back(gguf_get_arr_str(ctx, key, i), gguf_get_arr_str(ctx, key, i + 1));
+    }
+
+    return result;
+}
+
+std::vector<bert_token_t> token_ids(const gguf_context *ctx, const char *key) {
+    std::vector<bert_token_t> result;
+
+    const auto key_id = index(ctx, key);
+    if (key_id < 0) {
+        return result;
+    }
+
+    const auto type = gguf_get_kv_type(ctx, key_id) == GGUF_TYPE_ARRAY
+                          ? gguf_get_arr_type(ctx, key_id)
+                          : GGUF_TYPE_COUNT;
+    if (type != GGUF_TYPE_INT32 && type != GGUF_TYPE_UINT32) {
+        log::warn("{} must be an array of i32 or u32; ignored", key);
+        return result;
+    }
+
+    const auto n = gguf_get_arr_n(ctx, key_id);
+    const auto data = static_cast<const uint32_t *>(gguf_get_arr_data(ctx, key_id));
+    result.assign(data, data + n);
+
+    return result;
+}
+
 //
 // gguf loader
 //
@@ -149,6 +200,15 @@ static gg_ctx init_gg(const std::string &path, size_t *ctx_size) {
         }
     }
 
+    // aliased tensors have no data of their own
+    {
+        const auto aliases = tensor_aliases(gguf);
+        for (const auto &[alias, target] : aliases) {
+            ctx_size_ += ggml_tensor_overhead();
+            log::debug("  alias {} -> {}", alias, target);
+        }
+    }
+
     log::info("  model_size: {} ({} MiB)", ctx_size_, ctx_size_ / 1024 / 1024);
 
     if (ctx_size) {
@@ -158,59 +218,7 @@ static gg_ctx init_gg(const std::string &path, size_t *ctx_size) {
     return gg;
 }
 
-berts_context *load_from_file(const std::string &path) {
-    log::info("loading model: {}", path);
-
-    size_t ctx_size;
-    gg_ctx gg = init_gg(path, &ctx_size);
-
-    auto &gguf = gg.gguf();
-    auto &ggml_meta = gg.ggml();
-
-    if (!gg || !gguf || !ggml_meta) {
-        log::error("fail to load gguf file: {}", path);
-        return nullptr;
-    }
-
-    ggml_init_params params = {
-        .mem_size = ctx_size,
-        .mem_buffer = nullptr,
-        .no_alloc = false,
-    };
-    ggml_ctx ggml{params};
-    if (!ggml) {
-        log::error("fail to init ggml");
-        return nullptr;
-    }
-
-    std::ifstream in{path, std::ios::binary};
-    if (!in) {
-        log::error("fail to open gguf file");
-        return nullptr;
-    }
-
-    // load tensors
-    {
-        const auto n_tensors = gguf_get_n_tensors(gguf);
-        for (int i = 0; i < n_tensors; ++i) {
-            const auto tensor_name = gguf_get_tensor_name(gguf, i);
-            log::when(BERTS_LOG_DEBUG, [=]() {
-                log::debug("  load {} {}", i, tensor_name);
-            });
-            auto t = ggml_get_tensor(ggml_meta, tensor_name);
-            auto x = ggml_dup_tensor(ggml, t);
-            ggml_set_name(x, tensor_name);
-
-            const auto offset = gguf_get_data_offset(gguf) + gguf_get_tensor_offset(gguf, i);
-            in.seekg(offset, std::ios::beg);
-            if (!in) {
-                log::error("failed to seek gguf file");
-                return nullptr;
-            }
-            in.read((char *)x->data, ggml_nbytes(t));
-        }
-    }
-
+static internal::hparams read_hparams(const gguf_context *gguf) {
     internal::hparams hparams{};
     hparams.architecture = static_cast<bert_type>(gguf_u32(gguf, BERTS_KEY_HPARAM_BERT_TYPE));
     hparams.vocab_size = gguf_u32(gguf, BERTS_KEY_HPARAM_VOCAB_SIZE);
@@ -249,8 +257,10 @@ berts_context *load_from_file(const std::string &path) {
         hparams.eps,
         hparams.initializer_range);
 
-    const auto type = static_cast<ggml_type>(gguf_u32(gguf, "general.file_type"));
+    return hparams;
+}
 
+static internal::model *create_model(const internal::hparams &hparams, ggml_type type) {
     // check type
     ftype(type);
 
@@ -265,28 +275,293 @@ berts_context *load_from_file(const std::string &path) {
         return nullptr;
     }
 
-    internal::model *model;
-
     // create model
     switch (hparams.architecture) {
         using enum bert_type;
     case BERTS_TYPE_BERT:
         // BERT
-        model = new bert::model(type);
-        break;
+        return new bert::model(type);
     case BERTS_TYPE_ROBERTA:
         // RoBERTa
-        model = new roberta::model(type);
-        break;
+        return new roberta::model(type);
     default:
         log::error("unknown bert_type: {}", (int)hparams.architecture);
         return nullptr;
     }
+}
+
+berts_context *load_from_file(const std::string &path) {
+    berts_load_params params{};
+    berts_init_load_params(&params);
+    return load_from_file(path, params);
+}
+
+// create ggml_context whose tensors point into the mapped file
+static ggml_ctx map_tensors(gguf_context *gguf, ggml_context *ggml_meta, const memory::page_buffer &file) {
+    const size_t data_offset = gguf_get_data_offset(gguf);
+    const size_t alignment = gguf_get_alignment(gguf);
+
+    if (data_offset % alignment != 0) {
+        log::warn("tensor data is not aligned: offset={}, alignment={}", data_offset, alignment);
+        return {};
+    }
+
+    // tensor data are not allocated
+    const auto n_tensors = gguf_get_n_tensors(gguf);
+    const size_t n_aliases = tensor_aliases(gguf).size();
+
+    ggml_init_params params = {
+        .mem_size = (n_tensors + n_aliases) * ggml_tensor_overhead(),
+        .mem_buffer = nullptr,
+        .no_alloc = true,
+    };
+    ggml_ctx ggml{params};
+    if (!ggml) {
+        return ggml;
+    }
+
+    for (int i = 0; i < n_tensors; ++i) {
+        const auto tensor_name = gguf_get_tensor_name(gguf, i);
+        auto t = ggml_get_tensor(ggml_meta, tensor_name);
+
+        const size_t offset = data_offset + gguf_get_tensor_offset(gguf, i);
+        if (offset % alignment != 0 || file.size() < offset + ggml_nbytes(t)) {
+            log::warn("invalid tensor offset: {} ({})", tensor_name, offset);
+            return {};
+        }
+
+        auto x = ggml_dup_tensor(ggml, t);
+        ggml_set_name(x, tensor_name);
+        x->data = static_cast<uint8_t *>(file.data()) + offset;
+    }
+
+    return ggml;
+}
+
+berts_context *load_from_file(const std::string &path, const berts_load_params &load_params) {
+    log::info("loading model: {}", path);
+
+    // share weights and vocab with the model already loaded from the same file
+    internal::model_id id{};
+    const bool has_id = internal::get_model_id(path, id);
+    if (has_id) {
+        if (auto ctx = internal::share_context(id, load_params)) {
+            log::info("model is already loaded; weights are shared: {}", id.path);
+            return ctx;
+        }
+    }
 
-    auto ctx = internal::new_context(hparams, model, gg.gguf().release(), ggml.release());
+    size_t ctx_size;
+    gg_ctx gg = init_gg(path, &ctx_size);
+
+    auto &gguf = gg.gguf();
+    auto &ggml_meta = gg.ggml();
+
+    if (!gg || !gguf || !ggml_meta) {
+        log::error("fail to load gguf file: {}", path);
+        return nullptr;
+    }
+
+    memory::page_buffer weights{};
+    ggml_ctx ggml{};
+
+    // map tensor data
+    if (load_params.use_mmap) {
+        if (weights.map_file(path, load_params.use_huge_pages)) {
+            ggml = map_tensors(gguf, ggml_meta, weights);
+        }
+        if (!ggml) {
+            log::warn("fail to map model file; fallback to copying: {}", path);
+            weights.release();
+        }
+    }
+
+    // copy tensor data
+    if (!ggml) {
+        if (load_params.use_huge_pages && !weights.alloc(ctx_size, true)) {
+            log::warn("fail to allocate weights buffer; fallback to default allocation");
+        }
+
+        ggml_init_params params = {
+            .mem_size = ctx_size,
+            .mem_buffer = weights.data(),
+            .no_alloc = false,
+        };
+        ggml = ggml_ctx{params};
+        if (!ggml) {
+            log::error("fail to init ggml");
+            return nullptr;
+        }
+
+        std::ifstream in{path, std::ios::binary};
+        if (!in) {
+            log::error("fail to open gguf file");
+            return nullptr;
+        }
+
+        // load tensors
+        const auto n_tensors = gguf_get_n_tensors(gguf);
+        for (int i = 0; i < n_tensors; ++i) {
+            const auto tensor_name = gguf_get_tensor_name(gguf, i);
+            log::when(BERTS_LOG_DEBUG, [=]() {
+                log::debug("  load {} {}", i, tensor_name);
+            });
+            auto t = ggml_get_tensor(ggml_meta, tensor_name);
+            auto x = ggml_dup_tensor(ggml, t);
+            ggml_set_name(x, tensor_name);
+
+            const auto offset = gguf_get_data_offset(gguf) + gguf_get_tensor_offset(gguf, i);
+            in.seekg(offset, std::ios::beg);
+            if (!in) {
+                log::error("failed to seek gguf file");
+                return nullptr;
+            }
+            in.read((char *)x->data, ggml_nbytes(t));
+        }
+    }
+
+    // resolve tensor aliases (e.g. tied weights)
+    {
+        const bool no_alloc = ggml_get_no_alloc(ggml);
+        ggml_set_no_alloc(ggml, true);
+        for (const auto &[alias, target] : tensor_aliases(gguf)) {
+            if (ggml_get_tensor(ggml, alias.c_str())) {
+                log::warn("tensor {} exists in the file; alias is ignored", alias);
+                continue;
+            }
+
+            auto t = ggml_get_tensor(ggml, target.c_str());
+            if (!t) {
+                log::error("alias target is not found: {} -> {}", alias, target);
+                return nullptr;
+            }
+
+            auto x = ggml_dup_tensor(ggml, t);
+            x->data = t->data;
+            ggml_set_name(x, alias.c_str());
+        }
+        ggml_set_no_alloc(ggml, no_alloc);
+    }
+
+    if (weights) {
+        log::info(
+            "weights\n"
+            "  mapped: {}\n"
+            "  huge pages: {} ({} / {} bytes)",
+            weights.is_file_mapping(),
+            weights.huge_pages(),
+            weights.huge_page_bytes(),
+            weights.size());
+    }
+
+    const auto hparams = read_hparams(gguf);
+    const auto type = static_cast<ggml_type>(gguf_u32(gguf, "general.file_type"));
+
+    internal::model *model = create_model(hparams, type);
+    if (!model) {
+        return nullptr;
+    }
+
+    auto ctx = internal::new_context(hparams, model, gg.gguf().release(), ggml.release(), std::move(weights), load_params, has_id ? &id : nullptr);
     return ctx;
 }
 
+bool estimate_memory(const std::string &path,
+                     size_t max_tokens,
+                     size_t batch,
+                     const berts_load_params &load_params,
+                     berts_memory_stats &stats) {
+    log::info("estimating memory: {}", path);
+
+    // read header only
+    size_t ctx_size;
+    gg_ctx gg = init_gg(path, &ctx_size);
+
+    auto &gguf = gg.gguf();
+    auto &ggml_meta = gg.ggml();
+
+    if (!gg || !gguf || !ggml_meta) {
+        log::error("fail to load gguf file: {}", path);
+        return false;
+    }
+
+    const auto hparams = read_hparams(gguf);
+    const auto type = static_cast<ggml_type>(gguf_u32(gguf, "general.file_type"));
+
+    std::unique_ptr<internal::model> model{create_model(hparams, type)};
+    if (!model) {
+        return false;
+    }
+
+    stats = {};
+
+    // weights
+    if (load_params.use_mmap) {
+        // whole file is mapped
+        internal::model_id id{};
+        if (internal::get_model_id(path, id)) {
+            stats.weights = id.size;
+        } else {
+            stats.weights = ctx_size;
+        }
+    } else if (load_params.use_huge_pages) {
+        stats.weights = internal::scratch_buffer_size(ctx_size, true);
+    } else {
+        stats.weights = ctx_size;
+    }
+
+    // vocab
+    {
+        auto vocab_size = ggml_get_tensor(ggml_meta, BERTS_KEY_ALL_VOCAB_SIZE);
+        auto vocab_data = ggml_get_tensor(ggml_meta, BERTS_KEY_ALL_VOCAB_DATA);
+        auto merge_data = ggml_get_tensor(ggml_meta, BERTS_KEY_ALL_MERGE_DATA);
+        if (!vocab_size || !vocab_data) {
+            log::error("vocab is not found");
+            return false;
+        }
+
+        const size_t n_tokens = vocab_size->ne[0];
+        const size_t n_bytes = vocab_data->ne[0];
+        const size_t n_merges = merge_data ? merge_data->ne[0] / 3 : 0;
+        stats.vocab = model->estimate_vocab_memory_size(n_tokens, n_bytes, n_merges);
+    }
+
+    // scratch
+    {
+        if (max_tokens == 0) {
+            max_tokens = hparams.max_tokens;
+        }
+        batch = std::max<size_t>(batch, 1);
+
+        berts_eval_info cond{};
+        berts_init_eval_info(&cond);
+        // the largest graph
+        cond.output_layer = hparams.n_layers;
+
+        size_t graph_size, work_size;
+        model->estimate_scratch_size(max_tokens, hparams, cond, graph_size, work_size);
+
+        stats.scratch = internal::scratch_buffer_size(graph_size, load_params.use_huge_pages) * batch;
+        stats.plan = internal::scratch_buffer_size(work_size, load_params.use_huge_pages) * batch;
+        stats.scratch_peak = graph_size + work_size;
+    }
+
+    log::info(
+        "estimated memory\n"
+        "  weights: {}\n"
+        "  vocab: {}\n"
+        "  scratch: {} (x{})\n"
+        "  plan: {} (x{})",
+        stats.weights,
+        stats.vocab,
+        stats.scratch,
+        batch,
+        stats.plan,
+        batch);
+
+    return true;
+}
+
 #if 0
 struct memory_stream_buffer : std::streambuf {
     memory_stream_buffer(const void *ptr, size_t size) {
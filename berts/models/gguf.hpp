@@ -3,12 +3,23 @@
 #include <cstdint>
 #include <istream>
 #include <string>
+#include <utility>
+#include <vector>
 #include "berts/models/internal.hpp"
 
 namespace berts::gguf {
 
 berts_context *load_from_file(const std::string &path);
 
+berts_context *load_from_file(const std::string &path, const berts_load_params &params);
+
+/// @brief estimate memory from the header of the model file
+bool estimate_memory(const std::string &path,
+                     size_t max_tokens,
+                     size_t batch,
+                     const berts_load_params &params,
+                     berts_memory_stats &stats);
+
 // berts_context *load_from_memory(const uint8_t *data, size_t data_len);
 
 // berts_context *load_from_stream(std::istream &stream);
@@ -19,6 +30,20 @@ berts_context *load_from_file(const std::string &path);
 
 std::string type_to_str(ggml_type type);
 
+using tensor_alias_t = std::pair<std::string, std::string>;
+
+/**
+ * read BERTS_KEY_ALL_TENSOR_ALIAS as (alias, target) pairs
+ * returns empty list when the key is not found
+ */
+std::vector<tensor_alias_t> tensor_aliases(const gguf_context *ctx);
+
+/**
+ * read an array of token ids (i32 or u32) such as BERTS_KEY_TOKENIZER_NEVER_SPLIT
+ * returns empty list when the key is not found
+ */
+std::vector<bert_token_t> token_ids(const gguf_context *ctx, const char *key);
+
 /**
  * gguf accessors
  * 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace berts::hash {
+
+// multiplier of Fibonacci hashing (2^64 / golden ratio)
+inline constexpr uint64_t golden = 0x9e3779b97f4a7c15ULL;
+
+/// @brief finalizer of SplitMix64; a bijection which changes about half of the bits for one flipped input bit
+constexpr uint64_t mix64(uint64_t x) noexcept {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+/// @brief hash of raw bytes, 8 bytes at a time
+inline uint64_t bytes(const void *data, size_t size) noexcept {
+    const auto p = static_cast<const unsigned char *>(data);
+    uint64_t h = golden ^ size;
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, p + i, 8);
+        h = (h ^ mix64(w)) * golden;
+    }
+
+    if (i < size) {
+        uint64_t w = 0;
+        std::memcpy(&w, p + i, size - i);
+        h = (h ^ mix64(w)) * golden;
+    }
+
+    return mix64(h);
+}
+
+inline uint64_t string(std::string_view s) noexcept {
+    return bytes(s.data(), s.size());
+}
+
+/// @brief hash of an ordered pair of 32-bit values; (a, b) and (b, a) differ
+constexpr uint64_t pair(uint32_t a, uint32_t b) noexcept {
+    return mix64(((uint64_t)a << 32) | b);
+}
+
+} // namespace berts::hash
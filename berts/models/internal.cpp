@@ -1,7 +1,16 @@
 #include "berts/models/internal.hpp"
 
+#include <atomic>
+#include <filesystem>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "berts/models/log.hpp"
+#include "berts/models/utils.hpp"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
 
 using namespace berts;
 
@@ -9,25 +18,101 @@ using namespace berts;
 // models
 //
 
-struct berts_context {
+namespace berts::internal {
+
+/// @brief immutable resources shared by contexts created from the same file
+struct shared_model {
     internal::hparams hparams;
+    berts_load_params params;
     std::unique_ptr<internal::model> model;
-    gguf_context *gguf;
-    ggml_context *ctx;
+    // must outlive `ctx`
+    memory::page_buffer weights;
+    gguf_ctx gguf;
+    ggml_ctx ctx;
 
-    berts_context(const internal::hparams &hparams, internal::model *model, gguf_context *gguf, ggml_context *ctx)
+    shared_model(const internal::hparams &hparams,
+                 internal::model *model,
+                 gguf_context *gguf,
+                 ggml_context *ctx,
+                 memory::page_buffer &&weights,
+                 const berts_load_params &params)
         : hparams(hparams)
+        , params(params)
         , model(model)
+        , weights(std::move(weights))
         , gguf(gguf)
         , ctx(ctx) {}
+};
+
+/// @brief `true` if weights loaded with `a` can be used by a caller which asked for `b`
+static bool same_layout(const berts_load_params &a, const berts_load_params &b) noexcept {
+    return a.use_mmap == b.use_mmap && a.use_huge_pages == b.use_huge_pages;
+}
+
+/// @brief process-wide registry of loaded models
+/// @note a file loaded with different layouts has one entry per layout
+struct model_registry {
+    std::mutex mutex;
+    std::vector<std::pair<model_id, std::weak_ptr<shared_model>>> models;
+
+    std::shared_ptr<shared_model> find(const model_id &id, const berts_load_params &params) {
+        std::lock_guard lock{mutex};
+        for (const auto &[key, weak] : models) {
+            if (key == id) {
+                auto model = weak.lock();
+                if (model && same_layout(model->params, params)) {
+                    return model;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void add(const model_id &id, const std::shared_ptr<shared_model> &model) {
+        std::lock_guard lock{mutex};
+        std::erase_if(models, [&id, &model](const auto &item) {
+            auto other = item.second.lock();
+            return !other || (item.first == id && same_layout(other->params, model->params));
+        });
+        models.emplace_back(id, model);
+    }
+
+    static model_registry &instance() {
+        static model_registry registry{};
+        return registry;
+    }
+};
+
+} // namespace berts::internal
+
+struct berts_context {
+    // per-context
+    internal::hparams hparams;
+    std::mutex scratch_mutex;
+    memory::page_buffer scratch_graph;
+    memory::page_buffer scratch_work;
+    std::atomic<size_t> scratch_peak{0};
+    // shared
+    std::shared_ptr<internal::shared_model> shared;
+
+    berts_context(std::shared_ptr<internal::shared_model> shared)
+        : hparams(shared->hparams)
+        , shared(std::move(shared)) {}
 
-    static berts_context *create(const internal::hparams &hparams, internal::model *model, gguf_context *gguf, ggml_context *ctx) {
+    static berts_context *create(const internal::hparams &hparams,
+                                 internal::model *model,
+                                 gguf_context *gguf,
+                                 ggml_context *ctx,
+                                 memory::page_buffer &&weights,
+                                 const berts_load_params &params,
+                                 const internal::model_id *id) {
         if (!model) {
             log::error("model is empty");
             return nullptr;
         }
 
-        berts_context *berts = new berts_context{hparams, model, gguf, ctx};
+        auto shared = std::make_shared<internal::shared_model>(hparams, model, gguf, ctx, std::move(weights), params);
+        berts_context *berts = new berts_context{shared};
 
         if (!model->init_vocab(berts)) {
             log::error("fail to load vocab");
@@ -41,9 +126,22 @@ struct berts_context {
             return nullptr;
         }
 
+        if (id) {
+            internal::model_registry::instance().add(*id, shared);
+        }
+
         return berts;
     }
 
+    static berts_context *share(const internal::model_id &id, const berts_load_params &params) {
+        // weights are laid out by the loader; do not hand them to a caller which asked for another layout
+        auto shared = internal::model_registry::instance().find(id, params);
+        if (!shared) {
+            return nullptr;
+        }
+        return new berts_context{std::move(shared)};
+    }
+
     static void free(berts_context *berts) {
         delete berts;
     }
@@ -63,8 +161,55 @@ bool model::eval(berts_context *ctx,
     return this->eval(ctx, tokens, segments, cond, out, out_count);
 }
 
-berts_context *new_context(const hparams &hparams, model *model, gguf_context *gguf, ggml_context *ctx) {
-    return berts_context::create(hparams, model, gguf, ctx);
+bool get_model_id(const std::string &path, model_id &id) {
+    namespace fs = std::filesystem;
+
+    std::error_code err;
+    const auto canonical = fs::canonical(path, err);
+    if (err) {
+        return false;
+    }
+
+    id.path = canonical.string();
+    id.device = 0;
+    id.inode = 0;
+
+#ifndef _WIN32
+    struct stat st;
+    if (stat(id.path.c_str(), &st) != 0) {
+        return false;
+    }
+    id.device = (uint64_t)st.st_dev;
+    id.inode = (uint64_t)st.st_ino;
+    id.size = (uint64_t)st.st_size;
+#else
+    id.size = (uint64_t)fs::file_size(canonical, err);
+    if (err) {
+        return false;
+    }
+#endif
+
+    // st_mtim is not portable (st_mtimespec on macOS)
+    id.mtime = (int64_t)fs::last_write_time(canonical, err).time_since_epoch().count();
+    if (err) {
+        return false;
+    }
+
+    return true;
+}
+
+berts_context *new_context(const hparams &hparams,
+                           model *model,
+                           gguf_context *gguf,
+                           ggml_context *ctx,
+                           memory::page_buffer &&weights,
+                           const berts_load_params &params,
+                           const model_id *id) {
+    return berts_context::create(hparams, model, gguf, ctx, std::move(weights), params, id);
+}
+
+berts_context *share_context(const model_id &id, const berts_load_params &params) {
+    return berts_context::share(id, params);
 }
 
 void free_context(berts_context *ctx) {
@@ -72,11 +217,11 @@ void free_context(berts_context *ctx) {
 }
 
 gguf_context *get_gguf_context(berts_context *ctx) {
-    return ctx->gguf;
+    return ctx->shared->gguf;
 }
 
 ggml_context *get_ggml_context(berts_context *ctx) {
-    return ctx->ctx;
+    return ctx->shared->ctx;
 }
 
 bool get_hparams(const berts_context *ctx, hparams *params) {
@@ -91,16 +236,125 @@ bool get_hparams(const berts_context *ctx, hparams *params) {
     return true;
 }
 
+const hparams &get_hparams(const berts_context *ctx) {
+    return ctx->hparams;
+}
+
 bool is_model_loaded(const berts_context *ctx) {
-    return ctx && ctx->model;
+    return ctx && ctx->shared && ctx->shared->model;
 }
 
 model &get_model(berts_context *ctx) {
-    return *ctx->model;
+    return *ctx->shared->model;
 }
 
 const model &get_model(const berts_context *ctx) {
-    return *ctx->model;
+    return *ctx->shared->model;
+}
+
+void get_huge_pages_info(const berts_context *ctx, berts_huge_pages_info &info) {
+    info = {};
+
+    if (ctx->shared) {
+        const auto &weights = ctx->shared->weights;
+        if (weights) {
+            info.weights_size = weights.size();
+            info.weights_huge = weights.huge_page_bytes();
+        } else if (ctx->shared->ctx) {
+            info.weights_size = ggml_get_mem_size(ctx->shared->ctx);
+        }
+    }
+
+    auto &mutex = const_cast<berts_context *>(ctx)->scratch_mutex;
+    std::lock_guard lock{mutex};
+    for (const auto buf : {&ctx->scratch_graph, &ctx->scratch_work}) {
+        info.scratch_size += buf->size();
+        info.scratch_huge += buf->huge_page_bytes();
+    }
+}
+
+void get_memory_usage(const berts_context *ctx, berts_memory_stats &stats) {
+    stats = {};
+
+    if (const auto &shared = ctx->shared) {
+        if (shared->weights) {
+            stats.weights = shared->weights.size();
+        } else if (shared->ctx) {
+            stats.weights = ggml_get_mem_size(shared->ctx);
+        }
+        if (shared->model) {
+            stats.vocab = shared->model->vocab_memory_size();
+        }
+    }
+
+    auto &mutex = const_cast<berts_context *>(ctx)->scratch_mutex;
+    std::lock_guard lock{mutex};
+    stats.scratch = ctx->scratch_graph.size();
+    stats.plan = ctx->scratch_work.size();
+    stats.scratch_peak = ctx->scratch_peak.load();
+}
+
+//
+// scratch
+//
+
+size_t scratch_buffer_size(size_t size, bool huge_pages) {
+    // round up to avoid frequent reallocation for slightly longer inputs
+    const size_t unit = huge_pages ? memory::huge_page_size : 64 * 1024;
+    return (size + unit - 1) / unit * unit;
+}
+
+// grow `buf` to hold at least `size` bytes
+static void *reserve_scratch(memory::page_buffer &buf, size_t size, bool huge_pages) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    if (buf.size() < size) {
+        const size_t new_size = scratch_buffer_size(size, huge_pages);
+        if (!buf.alloc(new_size, huge_pages)) {
+            log::error("fail to allocate scratch buffer: {} bytes", new_size);
+            return nullptr;
+        }
+        log::debug("scratch buffer: {} bytes (huge pages: {})", new_size, buf.huge_pages());
+    }
+
+    return buf.data();
+}
+
+scratch::scratch(berts_context *ctx)
+    : ctx(ctx)
+    , locked(ctx->scratch_mutex.try_lock())
+    , requested(0)
+    , tmp_graph()
+    , tmp_work() {
+    if (!locked) {
+        log::debug("scratch buffers are in use; use temporary ones");
+    }
+}
+
+scratch::~scratch() {
+    // record peak usage
+    auto peak = ctx->scratch_peak.load();
+    while (peak < requested && !ctx->scratch_peak.compare_exchange_weak(peak, requested)) {
+    }
+
+    if (locked) {
+        ctx->scratch_mutex.unlock();
+    }
+}
+
+void *scratch::graph(size_t size) {
+    // equal to the caller's params; models are shared only between loaders with the same layout
+    const bool huge = ctx->shared->params.use_huge_pages;
+    requested += size;
+    return reserve_scratch(locked ? ctx->scratch_graph : tmp_graph, size, huge);
+}
+
+void *scratch::work(size_t size) {
+    const bool huge = ctx->shared->params.use_huge_pages;
+    requested += size;
+    return reserve_scratch(locked ? ctx->scratch_work : tmp_work, size, huge);
 }
 
 } // namespace berts::internal
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "berts/berts.h"
 #include "berts/models/log.hpp"
+#include "berts/models/memory.hpp"
 
 namespace berts::internal {
 
@@ -76,9 +79,30 @@ struct model {
 
     virtual size_t vocab_count() const noexcept = 0;
 
+    // bytes allocated by vocab, trie and BPE tables
+    virtual size_t vocab_memory_size() const noexcept = 0;
+
+    virtual size_t estimate_vocab_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) const noexcept = 0;
+
+    // bytes of scratch buffers needed by eval
+    // graph_size: ggml_context, work_size: work data of ggml_cplan
+    virtual void estimate_scratch_size(size_t token_count,
+                                       const hparams &hparams,
+                                       const berts_eval_info &cond,
+                                       size_t &graph_size,
+                                       size_t &work_size) const = 0;
+
+    // a long text is split into chunks and tokenized on `n_threads` threads
+    // <=0 for default value (= 4)
+    // tokens are appended to `out`, and their byte ranges in `text` to `spans` if not null
     virtual bool tokenize(const berts_context *ctx,
-                          const std::string &text,
-                          std::vector<bert_token_t> &out) const = 0;
+                          std::string_view text,
+                          std::vector<bert_token_t> &out,
+                          std::vector<berts_token_span> *spans,
+                          int n_threads) const = 0;
+
+    // hits and misses of the word cache shared by tokenizers
+    virtual void tokenizer_cache_stats(berts_tokenizer_cache_stats &stats) const noexcept = 0;
 
     bool eval(berts_context *ctx,
               const std::vector<bert_token_t> &tokens,
@@ -102,13 +126,45 @@ struct model {
                          size_t &out_count) const = 0;
 };
 
+/// @brief identity of a model file, used to share loaded models in the process
+struct model_id {
+    std::string path; // canonical path
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    int64_t mtime;
+
+    bool operator==(const model_id &) const = default;
+};
+
+/// @brief get the identity of given file
+/// @param path path to the model file
+/// @param id [out] file identity
+/// @return `true` if succeeded
+bool get_model_id(const std::string &path, model_id &id);
+
 /// @brief create new `berts_context`
 /// @param hparams hyper parameters
 /// @param model model (invalidated if function call is failed)
 /// @param gguf gguf context (invalidated if function call is failed)
 /// @param ctx ggml context (invalidated if function call is failed)
+/// @param weights memory which holds tensor data of `ctx`, can be empty (moved into the context)
+/// @param params loading parameters
+/// @param id identity of the model file; if given, the model is shared with contexts created by `share_context`
 /// @return a pointer to new `berts_context` or `nullptr` if function call is failed
-berts_context *new_context(const hparams &hparams, model *model, gguf_context *gguf, ggml_context *ctx);
+berts_context *new_context(const hparams &hparams,
+                           model *model,
+                           gguf_context *gguf,
+                           ggml_context *ctx,
+                           memory::page_buffer &&weights,
+                           const berts_load_params &params,
+                           const model_id *id = nullptr);
+
+/// @brief create new `berts_context` sharing weights and vocab with an already loaded model
+/// @param id identity of the model file
+/// @param params loading parameters; the model is not shared if it was loaded with different ones
+/// @return a pointer to new `berts_context` or `nullptr` if the model is not loaded or not shareable
+berts_context *share_context(const model_id &id, const berts_load_params &params);
 
 void free_context(berts_context *ctx);
 
@@ -118,12 +174,52 @@ ggml_context *get_ggml_context(berts_context *ctx);
 
 bool get_hparams(const berts_context *ctx, hparams *params);
 
+/// @brief hparams of the context without copying; `ctx` must be valid
+const hparams &get_hparams(const berts_context *ctx);
+
 bool is_model_loaded(const berts_context *ctx);
 
 model &get_model(berts_context *ctx);
 
 const model &get_model(const berts_context *ctx);
 
+void get_huge_pages_info(const berts_context *ctx, berts_huge_pages_info &info);
+
+void get_memory_usage(const berts_context *ctx, berts_memory_stats &stats);
+
+/// @brief actual size of a scratch buffer allocated for `size` bytes
+size_t scratch_buffer_size(size_t size, bool huge_pages);
+
+/**
+ * per-context scratch buffers used in eval
+ *
+ * ---
+ * buffers are kept in the context and reused by subsequent evals;
+ * if they are in use by another thread, temporary buffers are allocated instead
+ */
+struct scratch {
+    scratch(berts_context *ctx);
+
+    scratch(const scratch &) = delete;
+
+    scratch &operator=(const scratch &) = delete;
+
+    ~scratch();
+
+    /// @brief get memory for ggml_context (at least `size` bytes)
+    void *graph(size_t size);
+
+    /// @brief get memory for ggml_cplan::work_data (at least `size` bytes)
+    void *work(size_t size);
+
+  private:
+    berts_context *ctx;
+    bool locked;
+    size_t requested;
+    memory::page_buffer tmp_graph;
+    memory::page_buffer tmp_work;
+};
+
 //
 // utilities
 //
@@ -93,3 +93,9 @@
 
 // type: [i32]
 #define BERTS_KEY_ALL_MERGE_DATA "berts.merge.data"
+
+// type: [str] *optional
+//   flat list of (alias, target) tensor name pairs;
+//   the alias is not stored in the file and shares the data of the target tensor
+//   e.g. tied weights: ["berts.bert.predictions.decoder.weight", "berts.bert.embeddings.word_embeddings.weight"]
+#define BERTS_KEY_ALL_TENSOR_ALIAS "berts.tensor.alias"
@@ -1,43 +1,269 @@
 #include "berts/models/log.hpp"
 
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <utility>
+
 namespace berts::log {
 
-berts_log_level LOG_LEVEL = berts_log_level::BERTS_LOG_DEFAULT;
+std::atomic<int> LOG_LEVEL{berts_log_level::BERTS_LOG_DEFAULT};
 
-FILE *LOG_FILE = stderr;
+static std::atomic<FILE *> LOG_FILE{stderr};
 
 void set_log_level(berts_log_level level) {
-    LOG_LEVEL = level;
+    LOG_LEVEL.store(level, std::memory_order_relaxed);
 }
 
 berts_log_level get_log_level() {
-    return LOG_LEVEL;
+    return static_cast<berts_log_level>(LOG_LEVEL.load(std::memory_order_relaxed));
 }
 
-bool is_logging(berts_log_level level) {
-    return static_cast<int>(LOG_LEVEL) <= static_cast<int>(level);
+static void write(FILE *file, const std::string &msg) {
+    if (file) {
+        // one call, so that lines written from several threads are not interleaved
+        std::fprintf(file, "%s\n", msg.c_str());
+    }
 }
 
-void set_log_file(FILE *file) {
-    LOG_FILE = file;
+//
+// asynchronous sink
+//
+// a bounded lock-free queue (D. Vyukov's MPMC queue, used with one consumer);
+// producers move their message into a cell and never wait for the file.
+// a background thread writes the messages and flushes the file once per batch.
+// when the queue is full the message is dropped and counted.
+// messages left in the queue when the thread stops are written by the stopping thread,
+// and messages pushed after that by the pushing thread.
+//
+
+struct sink {
+    static constexpr size_t capacity = 1024; // power of 2
+
+    struct cell {
+        std::atomic<size_t> seq;
+        std::string msg;
+    };
+
+    std::array<cell, capacity> cells;
+    alignas(64) std::atomic<size_t> head{0}; // next position to push
+    alignas(64) size_t tail = 0;             // next position to pop (consumer only)
+
+    // bumped on each push to wake up the consumer
+    std::atomic<uint32_t> pushed{0};
+    // messages written so far, for flush()
+    std::atomic<size_t> written{0};
+    // messages dropped so far, and how many of them are reported (consumer only writes `reported`)
+    std::atomic<size_t> dropped{0};
+    std::atomic<size_t> reported{0};
+
+    std::atomic<bool> running{false};
+    std::thread thread;
+
+    sink() {
+        for (size_t i = 0; i < capacity; ++i) {
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(std::string &&msg) {
+        size_t pos = head.load(std::memory_order_relaxed);
+        cell *c;
+        while (true) {
+            c = &cells[pos & (capacity - 1)];
+            const size_t seq = c->seq.load(std::memory_order_acquire);
+            const auto diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // full
+                return false;
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+
+        c->msg = std::move(msg);
+        c->seq.store(pos + 1, std::memory_order_release);
+
+        pushed.fetch_add(1, std::memory_order_release);
+        pushed.notify_one();
+        return true;
+    }
+
+    // `msg` receives the message; the cell keeps the old buffer of `msg` for reuse
+    bool pop(std::string &msg) {
+        cell &c = cells[tail & (capacity - 1)];
+        if (c.seq.load(std::memory_order_acquire) != tail + 1) {
+            return false;
+        }
+        msg.swap(c.msg);
+        c.seq.store(tail + capacity, std::memory_order_release);
+        tail += 1;
+        return true;
+    }
+
+    // consumer only
+    size_t drain(std::string &msg) {
+        FILE *file = LOG_FILE.load(std::memory_order_acquire);
+        size_t n = 0;
+        while (pop(msg)) {
+            write(file, msg);
+            n += 1;
+        }
+
+        const auto total_dropped = dropped.load(std::memory_order_acquire);
+        const auto k = total_dropped - reported.load(std::memory_order_relaxed);
+        if (k != 0) {
+            write(file, fmt::fmt("[berts] {} log messages were dropped", k));
+        }
+
+        if (n != 0 || k != 0) {
+            if (file) std::fflush(file);
+        }
+        if (n != 0) {
+            written.fetch_add(n, std::memory_order_release);
+            written.notify_all();
+        }
+        if (k != 0) {
+            reported.store(total_dropped, std::memory_order_release);
+            reported.notify_all();
+        }
+        return n;
+    }
+
+    void run() {
+        std::string msg{};
+        while (true) {
+            const auto seen = pushed.load(std::memory_order_acquire);
+            if (drain(msg) == 0) {
+                if (!running.load(std::memory_order_acquire)) break;
+                pushed.wait(seen, std::memory_order_acquire);
+            }
+        }
+    }
+
+    void flush() {
+        const size_t target = head.load(std::memory_order_acquire);
+        const size_t target_dropped = dropped.load(std::memory_order_acquire);
+        for (size_t n = written.load(std::memory_order_acquire); n < target; n = written.load(std::memory_order_acquire)) {
+            written.wait(n, std::memory_order_acquire);
+        }
+        for (size_t n = reported.load(std::memory_order_acquire); n < target_dropped; n = reported.load(std::memory_order_acquire)) {
+            reported.wait(n, std::memory_order_acquire);
+        }
+    }
+};
+
+// never destroyed; the thread is stopped at exit
+static std::atomic<sink *> SINK{nullptr};
+static std::mutex SINK_MUTEX; // guards start/stop only
+static std::atomic<bool> ASYNC{false}; // opt-in
+static std::atomic<bool> EXITING{false};
+
+static void stop_sink() {
+    std::lock_guard lock{SINK_MUTEX};
+    sink *s = SINK.load(std::memory_order_acquire);
+    if (s && s->running.load(std::memory_order_relaxed)) {
+        s->running.store(false, std::memory_order_seq_cst);
+        s->pushed.fetch_add(1, std::memory_order_release);
+        s->pushed.notify_one();
+        s->thread.join();
+
+        // pairs with the fence in post(): a producer which saw the sink running has its message drained here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::string msg{};
+        s->drain(msg);
+    }
 }
 
-FILE *get_log_file() {
-    return LOG_FILE;
+static void stop_sink_at_exit() {
+    EXITING.store(true, std::memory_order_release);
+    stop_sink();
 }
 
-static inline void write(const std::string &msg) {
-    if (LOG_FILE) {
-        fprintf(LOG_FILE, msg.c_str());
-        fprintf(LOG_FILE, "\n");
-        fflush(LOG_FILE);
+static sink *get_sink() {
+    if (!ASYNC.load(std::memory_order_relaxed) || EXITING.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    sink *s = SINK.load(std::memory_order_acquire);
+    if (s && s->running.load(std::memory_order_acquire)) {
+        return s;
+    }
+
+    std::lock_guard lock{SINK_MUTEX};
+    if (!ASYNC.load(std::memory_order_relaxed) || EXITING.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    s = SINK.load(std::memory_order_relaxed);
+    if (!s) {
+        s = new sink{};
+        SINK.store(s, std::memory_order_release);
+        std::atexit(stop_sink_at_exit);
+    }
+    if (!s->running.load(std::memory_order_relaxed)) {
+        s->running.store(true, std::memory_order_release);
+        s->thread = std::thread{[s] { s->run(); }};
+    }
+    return s;
+}
+
+static void post(const std::string &msg) {
+    if (auto s = get_sink()) {
+        if (!s->push(std::string{msg})) {
+            s->dropped.fetch_add(1, std::memory_order_release);
+            s->pushed.fetch_add(1, std::memory_order_release);
+            s->pushed.notify_one();
+        }
+
+        // the sink may have been stopped after get_sink(); then nobody else drains the message
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!s->running.load(std::memory_order_relaxed)) {
+            std::lock_guard lock{SINK_MUTEX};
+            if (!s->running.load(std::memory_order_relaxed)) {
+                std::string buf{};
+                s->drain(buf);
+            }
+        }
+    } else {
+        FILE *file = LOG_FILE.load(std::memory_order_acquire);
+        write(file, msg);
+        if (file) std::fflush(file);
     }
 }
 
+void flush() {
+    sink *s = SINK.load(std::memory_order_acquire);
+    if (s && s->running.load(std::memory_order_acquire)) {
+        s->flush();
+    }
+}
+
+void set_log_async(bool async) {
+    ASYNC.store(async, std::memory_order_relaxed);
+    if (!async) {
+        stop_sink();
+    }
+}
+
+void set_log_file(FILE *file) {
+    flush();
+    LOG_FILE.store(file, std::memory_order_release);
+}
+
+FILE *get_log_file() {
+    return LOG_FILE.load(std::memory_order_acquire);
+}
+
 template <berts_log_level N>
 static inline void write_if(const std::string &msg) {
-    if ((int)LOG_LEVEL <= (int)N) {
-        write(msg);
+    if (is_logging(N)) {
+        post(msg);
     }
 }
 
@@ -1,22 +1,48 @@
 #pragma once
 
+#include <atomic>
 #include <cstdio>
 #include <string>
+#include <string_view>
 #include "berts/berts.h"
 #include "berts/models/fmt.hpp"
 
+// messages below this level are removed at compile time
+// (0: debug, 1: info, 2: warn, 3: error; see berts_log_level)
+#ifndef BERTS_MIN_LOG_LEVEL
+#define BERTS_MIN_LOG_LEVEL 0
+#endif
+
 namespace berts::log {
 
+// current level; use set_log_level/get_log_level
+extern std::atomic<int> LOG_LEVEL;
+
 void set_log_level(berts_log_level level);
 
 berts_log_level get_log_level();
 
-bool is_logging(berts_log_level level);
+/// @brief `false` if messages of `level` are compiled out
+constexpr bool is_compiled(berts_log_level level) noexcept {
+    return BERTS_MIN_LOG_LEVEL <= static_cast<int>(level);
+}
+
+inline bool is_logging(berts_log_level level) noexcept {
+    return is_compiled(level) && LOG_LEVEL.load(std::memory_order_relaxed) <= static_cast<int>(level);
+}
 
+/// @note queued messages are written to the old file before switching
 void set_log_file(FILE *file);
 
 FILE *get_log_file();
 
+/// @brief write messages on a background thread or on the calling thread (default)
+/// @note switching to synchronous mode writes the queued messages first
+void set_log_async(bool async);
+
+/// @brief wait until the queued messages are written
+void flush();
+
 template <typename Fn>
 bool when(berts_log_level level, Fn &&fn) {
     if (is_logging(level)) {
@@ -35,31 +61,57 @@ void warn(const std::string &msg);
 
 void error(const std::string &msg);
 
+// string literals (messages and formats) are not copied into std::string unless they are written
+
+inline void debug(const char *msg) {
+    if (is_logging(BERTS_LOG_DEBUG)) debug(std::string{msg});
+}
+
+inline void info(const char *msg) {
+    if (is_logging(BERTS_LOG_INFO)) info(std::string{msg});
+}
+
+inline void warn(const char *msg) {
+    if (is_logging(BERTS_LOG_WARN)) warn(std::string{msg});
+}
+
+inline void error(const char *msg) {
+    if (is_logging(BERTS_LOG_ERROR)) error(std::string{msg});
+}
+
 template <typename... Args>
-void debug(const std::string &fmt, Args... args) {
-    if (is_logging(BERTS_LOG_DEBUG)) {
-        debug(berts::fmt::fmt(fmt, args...));
+void debug(std::string_view fmt, Args... args) {
+    if constexpr (is_compiled(BERTS_LOG_DEBUG)) {
+        if (is_logging(BERTS_LOG_DEBUG)) {
+            debug(berts::fmt::fmt(fmt, args...));
+        }
     }
 }
 
 template <typename... Args>
-void info(const std::string &fmt, Args... args) {
-    if (is_logging(BERTS_LOG_INFO)) {
-        info(berts::fmt::fmt(fmt, args...));
+void info(std::string_view fmt, Args... args) {
+    if constexpr (is_compiled(BERTS_LOG_INFO)) {
+        if (is_logging(BERTS_LOG_INFO)) {
+            info(berts::fmt::fmt(fmt, args...));
+        }
     }
 }
 
 template <typename... Args>
-void warn(const std::string &fmt, Args... args) {
-    if (is_logging(BERTS_LOG_WARN)) {
-        warn(berts::fmt::fmt(fmt, args...));
+void warn(std::string_view fmt, Args... args) {
+    if constexpr (is_compiled(BERTS_LOG_WARN)) {
+        if (is_logging(BERTS_LOG_WARN)) {
+            warn(berts::fmt::fmt(fmt, args...));
+        }
     }
 }
 
 template <typename... Args>
-void error(const std::string &fmt, Args... args) {
-    if (is_logging(BERTS_LOG_INFO)) {
-        error(berts::fmt::fmt(fmt, args...));
+void error(std::string_view fmt, Args... args) {
+    if constexpr (is_compiled(BERTS_LOG_ERROR)) {
+        if (is_logging(BERTS_LOG_ERROR)) {
+            error(berts::fmt::fmt(fmt, args...));
+        }
     }
 }
 
@@ -0,0 +1,294 @@
+#include "berts/models/memory.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <utility>
+#include "berts/models/log.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace berts::memory {
+
+static constexpr size_t heap_alignment = 4096;
+
+static inline size_t round_up(size_t size, size_t align) {
+    return (size + align - 1) / align * align;
+}
+
+#ifndef _WIN32
+
+static inline size_t page_size() {
+    static const size_t size = (size_t)sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+// map `len` bytes at an address aligned to `align`
+// (over-allocate, then trim the head and the tail)
+static void *map_aligned(size_t len, size_t align, int prot) {
+    const size_t reserved = len + align;
+    void *p = mmap(nullptr, reserved, prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const auto addr = (uintptr_t)p;
+    const auto aligned = round_up(addr, align);
+    const size_t head = aligned - addr;
+    const size_t tail = reserved - head - len;
+
+    if (head != 0) {
+        munmap(p, head);
+    }
+    if (tail != 0) {
+        munmap((void *)(aligned + len), tail);
+    }
+
+    return (void *)aligned;
+}
+
+#endif
+
+page_buffer::page_buffer(page_buffer &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , mapped_(std::exchange(other.mapped_, 0))
+    , kind_(std::exchange(other.kind_, kind::none))
+    , huge_(std::exchange(other.huge_, false)) {}
+
+page_buffer &page_buffer::operator=(page_buffer &&other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, 0);
+        kind_ = std::exchange(other.kind_, kind::none);
+        huge_ = std::exchange(other.huge_, false);
+    }
+    return *this;
+}
+
+page_buffer::~page_buffer() {
+    release();
+}
+
+bool page_buffer::alloc(size_t size, bool huge_pages) {
+    release();
+
+    if (size == 0) {
+        return false;
+    }
+
+#ifndef _WIN32
+    if (huge_pages) {
+        const size_t len = round_up(size, huge_page_size);
+
+#ifdef MAP_HUGETLB
+        // explicit huge pages
+        void *p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            data_ = p;
+            size_ = size;
+            mapped_ = len;
+            kind_ = kind::anon;
+            huge_ = true;
+            return true;
+        }
+        log::debug("MAP_HUGETLB is not available ({}); fallback to transparent huge pages", std::strerror(errno));
+#endif
+
+        // transparent huge pages
+        if (void *q = map_aligned(len, huge_page_size, PROT_READ | PROT_WRITE)) {
+            data_ = q;
+            size_ = size;
+            mapped_ = len;
+            kind_ = kind::anon;
+#ifdef MADV_HUGEPAGE
+            huge_ = madvise(q, len, MADV_HUGEPAGE) == 0;
+#endif
+            if (!huge_) {
+                log::debug("MADV_HUGEPAGE is not available; fallback to normal pages");
+            }
+            return true;
+        }
+    }
+
+    // normal pages
+    {
+        const size_t len = round_up(size, page_size());
+        void *p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED) {
+            data_ = p;
+            size_ = size;
+            mapped_ = len;
+            kind_ = kind::anon;
+            return true;
+        }
+    }
+#else
+    (void)huge_pages;
+#endif
+
+    // heap
+    void *p = ::operator new(size, std::align_val_t{heap_alignment}, std::nothrow);
+    if (!p) {
+        return false;
+    }
+    std::memset(p, 0, size);
+    data_ = p;
+    size_ = size;
+    mapped_ = size;
+    kind_ = kind::heap;
+    return true;
+}
+
+bool page_buffer::map_file(const std::string &path, bool huge_pages) {
+    release();
+
+#ifndef _WIN32
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    const size_t size = (size_t)st.st_size;
+    const size_t len = round_up(size, page_size());
+
+    void *p = nullptr;
+    if (huge_pages) {
+        // reserve 2 MiB aligned address range, then map the file over it
+        void *reserved = map_aligned(len, huge_page_size, PROT_NONE);
+        if (reserved) {
+            p = mmap(reserved, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+            if (p == MAP_FAILED) {
+                munmap(reserved, len);
+                p = nullptr;
+            }
+        }
+    }
+
+    if (!p) {
+        p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            p = nullptr;
+        }
+    }
+
+    close(fd);
+
+    if (!p) {
+        return false;
+    }
+
+    data_ = p;
+    size_ = size;
+    mapped_ = len;
+    kind_ = kind::file;
+
+#ifdef MADV_HUGEPAGE
+    if (huge_pages) {
+        // file-backed huge pages need CONFIG_READ_ONLY_THP_FOR_FS
+        huge_ = madvise(p, len, MADV_HUGEPAGE) == 0;
+    }
+#endif
+
+    return true;
+#else
+    (void)path;
+    (void)huge_pages;
+    return false;
+#endif
+}
+
+void page_buffer::release() {
+    switch (kind_) {
+    case kind::heap:
+        ::operator delete(data_, std::align_val_t{heap_alignment});
+        break;
+#ifndef _WIN32
+    case kind::anon:
+    case kind::file:
+        munmap(data_, mapped_);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = 0;
+    kind_ = kind::none;
+    huge_ = false;
+}
+
+size_t page_buffer::huge_page_bytes() const {
+#ifdef __linux__
+    if (!data_ || kind_ == kind::heap) {
+        return 0;
+    }
+
+    std::ifstream smaps{"/proc/self/smaps"};
+    if (!smaps) {
+        return 0;
+    }
+
+    const auto lo = (uintptr_t)data_;
+    const auto hi = lo + mapped_;
+
+    static constexpr const char *keys[] = {
+        "AnonHugePages:",
+        "FilePmdMapped:",
+        "Private_Hugetlb:",
+        "Shared_Hugetlb:",
+    };
+
+    size_t total = 0;
+    bool in_range = false;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        const auto sp = line.find(' ');
+        const auto dash = line.find('-');
+        if (dash != std::string::npos && dash < sp) {
+            // header: "start-end perms offset dev inode path"
+            const auto start = (uintptr_t)std::strtoull(line.c_str(), nullptr, 16);
+            const auto end = (uintptr_t)std::strtoull(line.c_str() + dash + 1, nullptr, 16);
+            in_range = start < hi && lo < end;
+            continue;
+        }
+
+        if (!in_range) {
+            continue;
+        }
+
+        for (const auto key : keys) {
+            if (line.starts_with(key)) {
+                // "AnonHugePages:      2048 kB"
+                total += (size_t)std::strtoull(line.c_str() + std::strlen(key), nullptr, 10) * 1024;
+                break;
+            }
+        }
+    }
+
+    return std::min(total, mapped_);
+#else
+    return 0;
+#endif
+}
+
+} // namespace berts::memory
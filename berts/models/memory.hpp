@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace berts::memory {
+
+/// @brief size of huge pages requested by `page_buffer` (2 MiB)
+inline constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+/**
+ * page-aligned memory block, optionally backed by huge pages
+ *
+ * ---
+ * anonymous memory is allocated in the following order:
+ *   1. mmap(MAP_HUGETLB) (needs pre-reserved huge pages)
+ *   2. mmap aligned to 2 MiB + madvise(MADV_HUGEPAGE) (transparent huge pages)
+ *   3. normal pages
+ * file mappings are read-only and placed at 2 MiB aligned address,
+ * so that file offsets and addresses are congruent modulo huge page size
+ */
+struct page_buffer {
+    page_buffer() = default;
+
+    page_buffer(const page_buffer &) = delete;
+
+    page_buffer(page_buffer &&other) noexcept;
+
+    page_buffer &operator=(const page_buffer &) = delete;
+
+    page_buffer &operator=(page_buffer &&other) noexcept;
+
+    ~page_buffer();
+
+    /// @brief allocate zero-filled anonymous memory
+    /// @param size bytes to be allocated
+    /// @param huge_pages try to use huge pages
+    /// @return `false` if allocation is failed
+    bool alloc(size_t size, bool huge_pages);
+
+    /// @brief map whole file read-only
+    /// @param path path to the file
+    /// @param huge_pages try to use huge pages
+    /// @return `false` if mapping is failed or not supported on the platform
+    bool map_file(const std::string &path, bool huge_pages);
+
+    void release();
+
+    void *data() const noexcept {
+        return data_;
+    }
+
+    /// @brief requested size
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// @brief `true` if huge pages are requested and accepted by the OS (MAP_HUGETLB or MADV_HUGEPAGE)
+    bool huge_pages() const noexcept {
+        return huge_;
+    }
+
+    bool is_file_mapping() const noexcept {
+        return kind_ == kind::file;
+    }
+
+    /// @brief bytes currently backed by huge pages
+    /// @note read from /proc/self/smaps; always 0 when it is not available
+    size_t huge_page_bytes() const;
+
+    explicit operator bool() const noexcept {
+        return data_ != nullptr;
+    }
+
+  private:
+    enum class kind {
+        none,
+        heap,
+        anon,
+        file,
+    };
+
+    void *data_ = nullptr;
+    size_t size_ = 0;
+    // actually mapped bytes (rounded up to page size)
+    size_t mapped_ = 0;
+    kind kind_ = kind::none;
+    bool huge_ = false;
+};
+
+} // namespace berts::memory
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <string_view>
 #include <type_traits>
-#include <unordered_map>
 #include <vector>
+#include "berts/models/flat_vocab.hpp"
 #include "berts/models/ggml.hpp"
 #include "berts/models/gguf.hpp"
 #include "berts/models/internal.hpp"
@@ -28,24 +29,27 @@ concept Vocab = requires(T &obj, berts_context *ctx, ggml_context *ggml, gguf_co
     { obj.eos_id() } -> std::convertible_to<bert_token_t>;
 
     { obj.token_count() } -> std::convertible_to<size_t>;
-    { obj.id_to_token(bert_token_t{}) } -> std::convertible_to<std::string>;
+    { obj.id_to_token(bert_token_t{}) } -> std::convertible_to<std::string_view>;
     { obj.token_to_id(str) } -> std::convertible_to<bert_token_t>;
 
     { obj.add_token(str) } -> std::convertible_to<bool>;
     { obj.has_token(str) } -> std::convertible_to<bool>;
+    obj.reserve(size_t{}, size_t{});
+    { obj.memory_size() } -> std::convertible_to<size_t>;
+    { T::estimate_memory_size(size_t{}, size_t{}, size_t{}) } -> std::convertible_to<size_t>;
 
     // called from class `base` after tokens have been added
     { obj.init(ctx, ggml, gguf) } -> std::convertible_to<bool>;
     obj.clear();
 
     // implemented in vocab_base
-    { obj.cls_token() } -> std::convertible_to<std::string>;
-    { obj.mask_token() } -> std::convertible_to<std::string>;
-    { obj.pad_token() } -> std::convertible_to<std::string>;
-    { obj.sep_token() } -> std::convertible_to<std::string>;
-    { obj.unk_token() } -> std::convertible_to<std::string>;
-    { obj.bos_token() } -> std::convertible_to<std::string>;
-    { obj.eos_token() } -> std::convertible_to<std::string>;
+    { obj.cls_token() } -> std::convertible_to<std::string_view>;
+    { obj.mask_token() } -> std::convertible_to<std::string_view>;
+    { obj.pad_token() } -> std::convertible_to<std::string_view>;
+    { obj.sep_token() } -> std::convertible_to<std::string_view>;
+    { obj.unk_token() } -> std::convertible_to<std::string_view>;
+    { obj.bos_token() } -> std::convertible_to<std::string_view>;
+    { obj.eos_token() } -> std::convertible_to<std::string_view>;
 };
 
 template <typename T>
@@ -99,13 +103,13 @@ struct vocab_base {
         return BERTS_INVALID_TOKEN_ID;
     }
 
-    std::string cls_token() const noexcept { return as_self()->id_to_token(as_self()->cls_id()); };
-    std::string mask_token() const noexcept { return as_self()->id_to_token(as_self()->mask_id()); };
-    std::string pad_token() const noexcept { return as_self()->id_to_token(as_self()->pad_id()); };
-    std::string sep_token() const noexcept { return as_self()->id_to_token(as_self()->sep_id()); };
-    std::string unk_token() const noexcept { return as_self()->id_to_token(as_self()->unk_id()); };
-    std::string bos_token() const noexcept { return as_self()->id_to_token(as_self()->bos_id()); };
-    std::string eos_token() const noexcept { return as_self()->id_to_token(as_self()->eos_id()); };
+    auto cls_token() const noexcept { return as_self()->id_to_token(as_self()->cls_id()); };
+    auto mask_token() const noexcept { return as_self()->id_to_token(as_self()->mask_id()); };
+    auto pad_token() const noexcept { return as_self()->id_to_token(as_self()->pad_id()); };
+    auto sep_token() const noexcept { return as_self()->id_to_token(as_self()->sep_id()); };
+    auto unk_token() const noexcept { return as_self()->id_to_token(as_self()->unk_id()); };
+    auto bos_token() const noexcept { return as_self()->id_to_token(as_self()->bos_id()); };
+    auto eos_token() const noexcept { return as_self()->id_to_token(as_self()->eos_id()); };
 
   protected:
     auto as_self() noexcept { return static_cast<typename Self::self_type *>(this); }
@@ -117,53 +121,62 @@ struct vocab_base2 : public vocab_base<vocab_base2<Self>> {
     using self_type = Self;
     using inherited = vocab_base2<Self>;
 
-    std::vector<std::string> id_to_token_;
-    std::unordered_map<std::string, bert_token_t> token_to_id_;
+    // single copy of all tokens; tokenizers refer to this
+    flat_vocab tokens_;
 
     vocab_base2() = default;
 
     size_t token_count() const noexcept {
-        return id_to_token_.size();
+        return tokens_.size();
     }
 
-    std::string id_to_token(bert_token_t token_id) const noexcept {
-        if (id_to_token_.size() <= token_id) {
-            log::error("token id {} is not found (max={})", token_id, id_to_token_.size());
+    std::string_view id_to_token(bert_token_t token_id) const noexcept {
+        if (tokens_.size() <= token_id) {
+            log::error("token id {} is not found (max={})", token_id, tokens_.size());
             return "";
         }
-        return id_to_token_[token_id];
+        return tokens_.at(token_id);
     }
 
-    bert_token_t token_to_id(const std::string &token) const noexcept {
-        const auto p = token_to_id_.find(token);
-        if (p == token_to_id_.end()) {
+    bert_token_t token_to_id(std::string_view token) const noexcept {
+        const auto id = tokens_.find(token);
+        if (id == BERTS_INVALID_TOKEN_ID) {
             log::error("token {} is not found", token);
-            return BERTS_INVALID_TOKEN_ID;
         }
-        return p->second;
+        return id;
     }
 
-    bool add_token(const std::string &token) {
+    bool add_token(std::string_view token) {
         if (has_token(token)) {
             log::warn("  token {} already exists", token);
             return false;
         }
 
-        const auto next_id = static_cast<bert_token_t>(id_to_token_.size());
-        id_to_token_.push_back(token);
-        token_to_id_[token] = next_id;
-        // log::debug("  token {}: {}", next_id, token);
+        tokens_.add(token);
+        // log::debug("  token {}: {}", tokens_.size() - 1, token);
         return true;
     }
 
-    bool has_token(const std::string &token) const noexcept {
-        const auto p = token_to_id_.find(token);
-        return p != token_to_id_.end();
+    bool has_token(std::string_view token) const noexcept {
+        return tokens_.contains(token);
+    }
+
+    void reserve(size_t n, size_t bytes = 0) {
+        tokens_.reserve(n, bytes);
     }
 
     void clear() {
-        id_to_token_.clear();
-        token_to_id_.clear();
+        tokens_.clear();
+    }
+
+    size_t memory_size() const noexcept {
+        return tokens_.memory_size();
+    }
+
+    /// @brief bytes needed to hold `n_tokens` tokens of `n_bytes` bytes in total and `n_merges` merge rules
+    static size_t estimate_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) noexcept {
+        (void)n_merges;
+        return flat_vocab::estimate_memory_size(n_tokens, n_bytes);
     }
 };
 
@@ -229,16 +242,17 @@ struct model_base : public model {
         const int64_t vocab_count = vocab_size->ne[0];
         auto token_lengths = static_cast<const uint8_t *>(vocab_size->data);
         const auto data = static_cast<const char *>(vocab_data->data);
+        vocab->reserve((size_t)vocab_count, (size_t)vocab_data->ne[0]);
         ptrdiff_t p = 0;
         for (int64_t token_id = 0; token_id < vocab_count; ++token_id) {
             size_t token_len = (size_t)token_lengths[token_id];
             if (token_len == 0) {
                 token_len = 256;
             }
-            std::string token{&data[p], token_len};
+            std::string_view token{&data[p], token_len};
             p += token_len;
 
-            if (!add_token(token)) {
+            if (!vocab->add_token(token)) {
                 log::error("failed to add token: {}", token);
                 vocab->clear();
                 return false;
@@ -281,7 +295,7 @@ struct model_base : public model {
 
     // delegate to vocab
     std::string id_to_token(bert_token_t token_id) const noexcept override {
-        return vocab->id_to_token(token_id);
+        return std::string{vocab->id_to_token(token_id)};
     }
 
     bert_token_t token_to_id(const std::string &token) const noexcept override {
@@ -328,9 +342,19 @@ struct model_base : public model {
         return vocab->token_count();
     }
 
+    size_t vocab_memory_size() const noexcept override {
+        return vocab->memory_size();
+    }
+
+    size_t estimate_vocab_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) const noexcept override {
+        return vocab_t::estimate_memory_size(n_tokens, n_bytes, n_merges);
+    }
+
     virtual bool tokenize(const berts_context *ctx,
-                          const std::string &text,
-                          std::vector<bert_token_t> &out) const override = 0;
+                          std::string_view text,
+                          std::vector<bert_token_t> &out,
+                          std::vector<berts_token_span> *spans,
+                          int n_threads) const override = 0;
 
     bool eval(berts_context *ctx,
               const std::vector<bert_token_t> &tokens,
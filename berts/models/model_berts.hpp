@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include "berts/models/model_base.hpp"
 
 namespace berts::internal {
@@ -16,8 +17,10 @@ struct model_berts : public model_base<VocabType, WeightsType> {
     virtual std::string model_name() const = 0;
 
     virtual bool tokenize(const berts_context *ctx,
-                          const std::string &text,
-                          std::vector<bert_token_t> &out) const override = 0;
+                          std::string_view text,
+                          std::vector<bert_token_t> &out,
+                          std::vector<berts_token_span> *spans,
+                          int n_threads) const override = 0;
 
     // compute ggml_context allocation memory size
     virtual ggml_size_info get_context_buffer_size(
@@ -32,6 +35,30 @@ struct model_berts : public model_base<VocabType, WeightsType> {
         const hparams &hparams,
         const berts_eval_lm_info &cond) const = 0;
 
+    void estimate_scratch_size(size_t token_count,
+                               const hparams &hparams,
+                               const berts_eval_info &cond,
+                               size_t &graph_size,
+                               size_t &work_size) const override {
+        auto last_layer_index = cond.output_layer;
+        if (last_layer_index < 0) {
+            last_layer_index += hparams.n_layers + 1;
+        }
+        last_layer_index = std::clamp<bert_int>(last_layer_index, 0, hparams.n_layers);
+
+        // ggml_context
+        graph_size = get_context_buffer_size(token_count, hparams, cond).calc(last_layer_index);
+
+        // work data of ggml_cplan (upper bound)
+        //   mul_mat: src1 converted to vec_dot_type, at most F32 (intermediate_dim, token_count)
+        //   soft_max: F32 (token_count,) for each thread
+        const size_t n_threads = cond.n_threads <= 0 ? GGML_DEFAULT_N_THREADS : cond.n_threads;
+        const size_t max_dim = std::max(hparams.hidden_dim, hparams.intermediate_dim);
+        work_size = std::max(sizeof(float) * max_dim * token_count,
+                             sizeof(float) * token_count * n_threads) +
+                    64 /* cache line */ * n_threads;
+    }
+
     // process forward for ggml_new_graph
     // after calling this function,
     // parameter `ctx` must have the tensor named "out"
@@ -145,10 +172,17 @@ struct model_berts : public model_base<VocabType, WeightsType> {
         // build graph and run the computation
         //
 
+        using clock = std::chrono::steady_clock;
+        const auto elapsed_us = [](clock::time_point t0, clock::time_point t1) {
+            return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        };
+        const auto t_start = clock::now();
+
         ggml_size_info size = get_context_buffer_size(n, hparams, new_cond);
+        internal::scratch scratch{ctx};
         ggml_init_params init{
             /* .mem_size   = */ size.calc(last_layer_index),
-            /* .mem_buffer = */ nullptr,
+            /* .mem_buffer = */ scratch.graph(size.calc(last_layer_index)),
             /* .no_alloc   = */ false,
         };
         ggml_ctx ggml{init};
@@ -167,15 +201,20 @@ struct model_berts : public model_base<VocabType, WeightsType> {
             return false;
         }
         ggml_build_forward_expand(gf, x);
+        const auto t_graph = clock::now();
+
         ggml_cplan cplan = ggml_graph_plan(gf, new_cond.n_threads);
 
-        std::unique_ptr<uint8_t[]> work_data{};
         if (cplan.work_size != 0) {
-            work_data.reset(new uint8_t[cplan.work_size]);
-            cplan.work_data = work_data.get();
+            cplan.work_data = static_cast<uint8_t *>(scratch.work(cplan.work_size));
+            if (!cplan.work_data) {
+                return false;
+            }
         }
+        const auto t_plan = clock::now();
 
         ggml_graph_compute(gf, &cplan);
+        const auto t_compute = clock::now();
 
 #ifdef BERTS_DEBUG
         auto &cc = ggml_context_for_debug::from(ggml.ctx);
@@ -198,6 +237,18 @@ struct model_berts : public model_base<VocabType, WeightsType> {
             std::copy_n(data, count, out);
         }
 
+        if (cond.timings) {
+            const auto t_output = clock::now();
+            *cond.timings = berts_eval_timings{
+                /* .graph_us   = */ elapsed_us(t_start, t_graph),
+                /* .plan_us    = */ elapsed_us(t_graph, t_plan),
+                /* .compute_us = */ elapsed_us(t_plan, t_compute),
+                /* .output_us  = */ elapsed_us(t_compute, t_output),
+                /* .graph_size = */ init.mem_size,
+                /* .work_size  = */ cplan.work_size,
+            };
+        }
+
         log::info("finish evaluating {}", model_name());
 
         return true;
@@ -266,9 +317,10 @@ struct model_berts : public model_base<VocabType, WeightsType> {
             output_tokens,
             hparams,
             cond);
+        internal::scratch scratch{ctx};
         ggml_init_params init{
             /* .mem_size   = */ size.calc(0),
-            /* .mem_buffer = */ nullptr,
+            /* .mem_buffer = */ scratch.graph(size.calc(0)),
             /* .no_alloc   = */ false,
         };
         ggml_ctx ggml{init};
@@ -290,10 +342,11 @@ struct model_berts : public model_base<VocabType, WeightsType> {
         ggml_build_forward_expand(gf, x);
         ggml_cplan cplan = ggml_graph_plan(gf, cond.n_threads);
 
-        std::unique_ptr<uint8_t[]> work_data{};
         if (cplan.work_size != 0) {
-            work_data.reset(new uint8_t[cplan.work_size]);
-            cplan.work_data = work_data.get();
+            cplan.work_data = static_cast<uint8_t *>(scratch.work(cplan.work_size));
+            if (!cplan.work_data) {
+                return false;
+            }
         }
 
         ggml_graph_compute(gf, &cplan);
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace berts::parallel {
+
+/// @brief call `fn(i)` for each `i` in [0, n) on `n_threads` threads (including the caller)
+/// @note each thread takes the next index until all indices are done
+template <typename Fn>
+void parallel_for(size_t n, size_t n_threads, Fn &&fn) {
+    n_threads = std::clamp<size_t>(n_threads, 1, std::max<size_t>(n, 1));
+
+    if (n_threads == 1) {
+        for (size_t i = 0; i < n; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    std::atomic_size_t next{0};
+    auto worker = [&next, &fn, n]() {
+        for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+            fn(i);
+        }
+    };
+
+    std::vector<std::jthread> threads;
+    threads.reserve(n_threads - 1);
+    for (size_t t = 1; t < n_threads; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+}
+
+/// @brief split `text` into at most `n_chunks` chunks of similar size
+/// @param min_chunk_size chunks are not made smaller than this
+/// @param is_boundary `is_boundary(text, i)` returns `true` if the text can be split before `text[i]`
+/// @return concatenation of the chunks is `text`
+template <typename Pred>
+std::vector<std::string_view> split_chunks(std::string_view text, size_t n_chunks, size_t min_chunk_size, Pred &&is_boundary) {
+    n_chunks = std::clamp<size_t>(n_chunks, 1, std::max<size_t>(text.size() / std::max<size_t>(min_chunk_size, 1), 1));
+    const size_t chunk_size = text.size() / n_chunks;
+
+    std::vector<std::string_view> chunks;
+    chunks.reserve(n_chunks);
+
+    size_t begin = 0;
+    for (size_t k = 1; k < n_chunks; ++k) {
+        // the first boundary after the target position
+        size_t i = std::max(begin + 1, k * chunk_size);
+        while (i < text.size() && !is_boundary(text, i)) {
+            ++i;
+        }
+        if (i >= text.size()) {
+            break;
+        }
+        chunks.push_back(text.substr(begin, i - begin));
+        begin = i;
+    }
+    chunks.push_back(text.substr(begin));
+
+    return chunks;
+}
+
+} // namespace berts::parallel
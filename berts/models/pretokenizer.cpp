@@ -0,0 +1,133 @@
+#include "berts/models/pretokenizer.hpp"
+
+#include <array>
+#include <cstdint>
+#include "berts/models/unicode.hpp"
+
+namespace berts::pretokenizer {
+
+namespace {
+
+enum class cls : uint8_t {
+    letter, // \p{L}
+    number, // \p{N}
+    space,  // \s
+    other,
+};
+
+constexpr cls class_of(unicode::unic32_t c) noexcept {
+    const auto p = unicode::properties(c);
+    if (p & unicode::tables::PROP_LETTER) return cls::letter;
+    if (p & unicode::tables::PROP_NUMBER) return cls::number;
+    if (p & unicode::tables::PROP_SPACE) return cls::space;
+    return cls::other;
+}
+
+// ASCII does not need to go through the two-stage table
+constexpr auto ascii_classes = []() {
+    std::array<cls, 128> t{};
+    for (unicode::unic32_t c = 0; c < 128; ++c) {
+        t[c] = class_of(c);
+    }
+    return t;
+}();
+
+/// @brief class of the code point at `s[i]`; `next` is set to the start of the next one
+inline cls class_at(std::string_view s, size_t i, size_t &next) noexcept {
+    const auto b = (unsigned char)s[i];
+    if (b < 0x80) {
+        next = i + 1;
+        return ascii_classes[b];
+    }
+    next = i;
+    return class_of(unicode::decode_utf8(s, next));
+}
+
+/// @brief end of the run of `k` which starts at `s[i]`
+inline size_t skip(std::string_view s, size_t i, cls k) noexcept {
+    const size_t n = s.size();
+    while (i < n) {
+        const auto b = (unsigned char)s[i];
+        if (b < 0x80) {
+            if (ascii_classes[b] != k) break;
+            i += 1;
+            continue;
+        }
+        size_t next;
+        if (class_at(s, i, next) != k) break;
+        i = next;
+    }
+    return i;
+}
+
+inline bool is_contraction(std::string_view s, size_t i, size_t &end) noexcept {
+    // 's|'t|'re|'ve|'m|'ll|'d
+    const size_t n = s.size();
+    if (s[i] != '\'' || n <= i + 1) {
+        return false;
+    }
+
+    const char c1 = s[i + 1];
+    if (c1 == 's' || c1 == 't' || c1 == 'm' || c1 == 'd') {
+        end = i + 2;
+        return true;
+    }
+
+    if (n <= i + 2) {
+        return false;
+    }
+
+    const char c2 = s[i + 2];
+    if ((c1 == 'r' && c2 == 'e') || (c1 == 'v' && c2 == 'e') || (c1 == 'l' && c2 == 'l')) {
+        end = i + 3;
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace
+
+size_t gpt2_next(std::string_view text, size_t begin) noexcept {
+    const size_t n = text.size();
+
+    size_t end;
+    if (is_contraction(text, begin, end)) {
+        return end;
+    }
+
+    size_t next;
+    const cls k = class_at(text, begin, next);
+
+    // ' ?\p{L}+' | ' ?\p{N}+' | ' ?[^\s\p{L}\p{N}]+'
+    if (text[begin] == ' ' && next < n) {
+        size_t next2;
+        const cls k2 = class_at(text, next, next2);
+        if (k2 != cls::space) {
+            return skip(text, next2, k2);
+        }
+    }
+
+    if (k != cls::space) {
+        return skip(text, next, k);
+    }
+
+    // '\s+(?!\S)' | '\s+'
+    // a run of spaces followed by a non-space leaves its last space
+    // to the next piece (e.g. "a  b" -> "a", " ", " b") unless the run is one space
+    size_t last = begin;
+    size_t i = next;
+    while (i < n) {
+        size_t j;
+        if (class_at(text, i, j) != cls::space) break;
+        last = i;
+        i = j;
+    }
+
+    if (i == n || last == begin) {
+        return i;
+    }
+    return last;
+}
+
+} // namespace berts::pretokenizer
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string_view>
+
+namespace berts::pretokenizer {
+
+/**
+ * byte-level BPE pre-tokenizer of GPT-2 / RoBERTa
+ *
+ * splits text in the same way as the regex
+ *   's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
+ * with a hand-written state machine over UTF-8, so neither a regex engine
+ * nor any allocation is needed. pieces are views of the input text.
+ *
+ * an invalid UTF-8 byte is treated as U+FFFD, i.e. neither a letter, a number nor a space.
+ */
+
+/// @brief end of the piece which starts at `text[begin]`
+/// @note `begin` must be less than `text.size()`
+size_t gpt2_next(std::string_view text, size_t begin) noexcept;
+
+/// @brief call `fn(piece)` for each piece of `text`
+template <typename Fn>
+void gpt2_split(std::string_view text, Fn &&fn) {
+    for (size_t i = 0; i < text.size();) {
+        const size_t j = gpt2_next(text, i);
+        fn(text.substr(i, j - i));
+        i = j;
+    }
+}
+
+} // namespace berts::pretokenizer
@@ -1,4 +1,5 @@
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <numeric>
@@ -7,6 +8,7 @@
 #include "berts/berts.h"
 #include "berts/models/gguf.hpp"
 #include "berts/models/internal.hpp"
+#include "berts/models/keys.h"
 #include "berts/models/log.hpp"
 #include "berts/models/utils.hpp"
 
@@ -38,6 +40,15 @@ static inline void write_zeros(std::ostream &out, size_t n) {
     }
 }
 
+// tied weights may be stored twice in older files
+static inline bool is_same_tensor(const ggml_tensor *a, const ggml_tensor *b) {
+    if (a->type != b->type) return false;
+    for (int i = 0; i < GGML_MAX_DIMS; ++i) {
+        if (a->ne[i] != b->ne[i]) return false;
+    }
+    return std::memcmp(a->data, b->data, ggml_nbytes(a)) == 0;
+}
+
 static inline bool quantize(const ggml_tensor *t, ggml_type new_type, conv_buf &buffer, size_t *new_size) {
     const size_t n = ggml_nelements(t);
     buffer.reserve(n);
@@ -90,6 +101,9 @@ bool berts_model_quantize(const char *input_path,
     gguf_set_kv(gguf_dst, gguf_src);
     gguf_set_val_u32(gguf_dst, "general.quantization_version", GGML_QNT_VERSION);
     gguf_set_val_u32(gguf_dst, "general.file_type", (uint32_t)qtype);
+    // tensor data are written with the alignment of gguf_dst, not the one copied from the source
+    // the loader relies on it to map tensor data directly
+    gguf_set_val_u32(gguf_dst, "general.alignment", (uint32_t)gguf_get_alignment(gguf_dst));
 
     std::ofstream out{output_path, std::ios::binary};
     if (!out) {
@@ -97,13 +111,47 @@ bool berts_model_quantize(const char *input_path,
         return false;
     }
 
-    const int n = gguf_get_n_tensors(gguf_src);
-    for (int i = 0; i < n; ++i) {
+    // tensors to be written, and tensors to be stored as aliases
+    std::vector<const char *> names;
+    auto aliases = gguf::tensor_aliases(gguf_src);
+    const auto n_aliases_org = aliases.size();
+
+    const int n_src = gguf_get_n_tensors(gguf_src);
+    for (int i = 0; i < n_src; ++i) {
         const char *name = gguf_get_tensor_name(gguf_src, i);
         auto t = ggml_get_tensor(ggml_src, name);
+
+        const char *target = nullptr;
+        if (t->n_dims == 2) {
+            for (const auto other : names) {
+                if (is_same_tensor(t, ggml_get_tensor(ggml_src, other))) {
+                    target = other;
+                    break;
+                }
+            }
+        }
+
+        if (target) {
+            log::info("{} is identical to {}; stored as alias", name, target);
+            aliases.emplace_back(name, target);
+            continue;
+        }
+
+        names.push_back(name);
         gguf_add_tensor(gguf_dst, t);
     }
 
+    if (n_aliases_org != aliases.size()) {
+        std::vector<const char *> alias_data;
+        for (const auto &[alias, target] : aliases) {
+            alias_data.push_back(alias.c_str());
+            alias_data.push_back(target.c_str());
+        }
+        gguf_set_arr_str(gguf_dst, BERTS_KEY_ALL_TENSOR_ALIAS, alias_data.data(), (int)alias_data.size());
+    }
+
+    const int n = (int)names.size();
+
     const size_t meta_size = gguf_get_meta_size(gguf_dst);
     write_zeros(out, meta_size);
 
@@ -120,7 +168,7 @@ bool berts_model_quantize(const char *input_path,
     //
     log::info("converting...");
     for (int i = 0; i < n; ++i) {
-        const char *name = gguf_get_tensor_name(gguf_src, i);
+        const char *name = names[i];
         auto t = ggml_get_tensor(ggml_src, name);
 
         bool q = false;
@@ -1,12 +1,15 @@
 #include "berts/models/roberta.hpp"
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <ranges>
 #include <unordered_map>
-#include <unordered_set>
 #include "berts/models/ggml.hpp"
+#include "berts/models/gguf.hpp"
 #include "berts/models/keys.h"
+#include "berts/models/parallel.hpp"
+#include "berts/models/pretokenizer.hpp"
 #include "berts/models/unicode.hpp"
 
 using namespace berts::internal;
@@ -60,9 +63,13 @@ static std::array<uint16_t, 256> byte_encoder{{
     // clang-format on
 }};
 
+// one-byte pieces are looked up by `byte_ids` directly
+static constexpr size_t min_cached_piece_size = 2;
+
 vocab::vocab()
     : inherited()
-    , bpe(nullptr) {
+    , bpe(nullptr)
+    , cache(word_cache::default_capacity, min_cached_piece_size) {
     special.bos = BERTS_INVALID_TOKEN_ID;
     special.eos = BERTS_INVALID_TOKEN_ID;
     special.cls = BERTS_INVALID_TOKEN_ID;
@@ -70,12 +77,26 @@ vocab::vocab()
     special.pad = BERTS_INVALID_TOKEN_ID;
     special.sep = BERTS_INVALID_TOKEN_ID;
     special.unk = BERTS_INVALID_TOKEN_ID;
+    byte_ids.fill(BERTS_INVALID_TOKEN_ID);
 }
 
 vocab::vocab(size_t n)
     : vocab() {
-    id_to_token_.reserve(n);
-    token_to_id_.reserve(n);
+    reserve(n);
+}
+
+size_t vocab::memory_size() const noexcept {
+    size_t size = inherited::memory_size();
+    if (bpe) {
+        size += sizeof(berts::bpe) + bpe->memory_size();
+    }
+    size += cache.memory_size();
+    size += special_matcher.memory_size();
+    return size;
+}
+
+size_t vocab::estimate_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) noexcept {
+    return inherited::estimate_memory_size(n_tokens, n_bytes, n_merges) + sizeof(berts::bpe) + berts::bpe::estimate_memory_size(n_merges);
 }
 
 bert_token_t vocab::cls_id() const noexcept {
@@ -107,23 +128,49 @@ bert_token_t vocab::eos_id() const noexcept {
 }
 
 std::string vocab::id_to_token(bert_token_t token_id) const noexcept {
-    unicode::ustr token{inherited::id_to_token(token_id)};
-    std::vector<char> chars{};
-    token.each_cp(false, [&chars](const unicode::ustr::cp &cp) {
-        chars.push_back(cp.c & 0xff);
-    });
-    // log::info("id_to_token: \"{}\" -> \"{}\"", inherited::id_to_token(token_id), std::string{chars.begin(), chars.end()});
-    return {chars.begin(), chars.end()};
+    // each code point of a byte-level token stands for one byte
+    const std::string_view token = inherited::id_to_token(token_id);
+    std::string chars{};
+    for (size_t i = 0; i < token.size();) {
+        chars.push_back((char)(unicode::decode_utf8(token, i) & 0xff));
+    }
+    return chars;
 }
 
 bert_token_t vocab::token_to_id(const std::string &token) const noexcept {
-    std::vector<unicode::unic_t> chars{};
+    std::string str{};
     for (char c : token) {
-        chars.push_back(byte_encoder[c]);
+        unicode::encode_utf8(byte_encoder[(uint8_t)c], str);
     }
-    unicode::ustr str{chars};
-    // log::info("token_to_id: \"{}\" -> \"{}\"", token, str.encode());
-    return inherited::token_to_id(str.encode());
+    return inherited::token_to_id(str);
+}
+
+void vocab::build_byte_ids() {
+    cache.clear();
+    for (size_t b = 0; b < byte_ids.size(); ++b) {
+        std::string symbol{};
+        unicode::encode_utf8(byte_encoder[b], symbol);
+        byte_ids[b] = token_to_id_internal(symbol);
+    }
+}
+
+bool vocab::build_special_tokens(std::span<const bert_token_t> never_split_ids) {
+    // tokens are matched against the raw text, so decode them
+    std::vector<std::string> strs{};
+    std::vector<bert_token_t> ids{special.bos, special.eos, special.cls, special.mask, special.pad, special.sep, special.unk};
+    ids.insert(ids.end(), never_split_ids.begin(), never_split_ids.end());
+    for (auto id : ids) {
+        strs.push_back(id_to_token(id));
+        if (strs.back().empty()) {
+            log::warn("unknown special token id {}; ignored", id);
+        }
+    }
+
+    std::vector<token_matcher::entry> tokens{};
+    for (size_t i = 0; i < ids.size(); ++i) {
+        tokens.emplace_back(strs[i], ids[i]);
+    }
+    return special_matcher.build(tokens);
 }
 
 bool vocab::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
@@ -189,18 +236,19 @@ bool vocab::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
     special.sep = sep_id;
     special.unk = unk_id;
 
+    build_byte_ids();
+
+    if (!build_special_tokens(gguf::token_ids(gguf, BERTS_KEY_TOKENIZER_NEVER_SPLIT))) {
+        log::error("fail to build special tokens");
+        return false;
+    }
+
     //
     // bpe initialization
     //
 
     bpe.reset(new berts::bpe{unk_token()});
 
-    // initialize bpe vocab from constructed vocab
-    bpe::vocab_t bpe_vocab{};
-    for (const auto &[id, token] : id_to_token_ | std::views::enumerate) {
-        bpe_vocab.emplace(token, id);
-    }
-
     // initialize merge vocab
     auto merge_data = ggml_get_tensor(ggml, BERTS_KEY_ALL_MERGE_DATA);
 
@@ -235,7 +283,8 @@ bool vocab::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
         merges.emplace_back(id0, id1);
     }
 
-    if (!bpe->load_vocab(bpe_vocab, merges)) {
+    // bpe refers to the tokens of this vocab
+    if (!bpe->load_vocab(tokens_, merges)) {
         log::error("failed to load bpe vocab");
         return false;
     }
@@ -247,132 +296,192 @@ bool vocab::init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf) {
 // tokenize
 //
 
-static bool tokenize(const vocab &vocab,
-                     const std::string &text,
-                     const std::unordered_set<std::string> &never_split,
-                     std::vector<bert_token_t> &result) {
-    log::info("tokenization start");
-
-    // split text into subtexts
-    // "<s>abc <mask>def</s>"
-    // -> "<s>", "abc ", "<mask>", "def", "</s>"
-    std::vector<std::pair<bool, std::string>> subtexts{};
-
-    {
-        std::string rest = text;
-        std::string tmp{};
-        while (rest.size() != 0) {
-            for (const auto &keep : never_split) {
-                if (rest.starts_with(keep)) {
-                    if (tmp.size() != 0) {
-                        subtexts.emplace_back(false, tmp);
-                        tmp.clear();
-                    }
-                    subtexts.emplace_back(true, keep);
-
-                    rest = rest.substr(keep.size());
-                    goto LOOP_END;
-                }
-            }
-            tmp += rest[0];
-            rest = rest.substr(1);
-        LOOP_END:
-        }
-
-        if (tmp.size() != 0) {
-            subtexts.emplace_back(false, tmp);
+// strip trailing '\t' + Zs
+static std::string_view rstrip(std::string_view s) noexcept {
+    size_t end = 0;
+    for (size_t i = 0; i < s.size();) {
+        if (!unicode::is_whitespace(unicode::decode_utf8(s, i))) {
+            end = i;
         }
     }
+    return s.substr(0, end);
+}
 
-    log::when(BERTS_LOG_DEBUG, [&subtexts]() {
-        log::debug("  subtexts:");
-        for (const auto &[is_special, subtext] : subtexts) {
-            log::debug("    \"{}\" {}", subtext, is_special ? "*" : "");
+// byte ranges of the tokens of a pre-tokenized piece at `offset`
+// each byte-level token covers as many bytes as its characters
+static void piece_spans(const vocab &vocab,
+                        size_t offset,
+                        size_t size,
+                        std::span<const bert_token_t> ids,
+                        std::vector<berts_token_span> &spans) {
+    const size_t n0 = spans.size();
+
+    size_t pos = offset;
+    for (const auto id : ids) {
+        size_t n = 1; // unknown byte
+        if (id != vocab.special.unk) {
+            n = 0;
+            for (char c : vocab.id_to_token_internal(id)) {
+                n += ((uint8_t)c & 0xc0) != 0x80;
+            }
         }
-    });
-
-    bpe::cache_t bpe_cache{};
-    unicode::regex re{R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)"};
-    std::string mask_token = vocab.mask_token();
+        spans.push_back({pos, pos + n});
+        pos += n;
+    }
 
-    // "<s>", "abc ", "<mask>", "def", "</s>"
-    // -> "<s>", "abc", "<mask>", "def", "</s>"
-    for (size_t i = 0; i < subtexts.size(); ++i) {
-        auto &[is_special, subtext_] = subtexts[i];
-        unicode::ustr subtext{subtext_};
+    if (pos != offset + size) {
+        spans.resize(n0);
+        spans.insert(spans.end(), ids.size(), berts_token_span{offset, offset + size});
+    }
+}
 
-        // Mask token behave like a normal word, i.e. include the space before it
-        if (i != subtexts.size() - 1) {
-            const auto &[is_special_next, subtext_next] = subtexts[i + 1];
-            if (is_special_next && subtext_next == mask_token) {
-                // use unicode whitespaces
-                subtext = subtext.rstrip();
+// pre-tokenize and apply bpe to a text without special tokens
+// `offset` is the position of `text` in the input, used for `spans`
+static bool tokenize_plain(const vocab &vocab,
+                           std::string_view text,
+                           size_t offset,
+                           std::vector<bert_token_t> &symbols,
+                           std::vector<bert_token_t> &result,
+                           std::vector<berts_token_span> *spans) {
+    const bool use_cache = vocab.bpe->dropout() == 0.0;
+
+    for (size_t begin = 0, end; begin < text.size(); begin = end) {
+        end = pretokenizer::gpt2_next(text, begin);
+        const auto piece = text.substr(begin, end - begin);
+
+        const size_t n = result.size();
+
+        const bool cacheable = use_cache && vocab.cache.accepts(piece);
+        if (!cacheable || !vocab.cache.find(piece, result)) {
+            // bytes -> byte-level symbols (control chars are replaced)
+            symbols.clear();
+            for (char c : piece) {
+                symbols.push_back(vocab.byte_ids[(uint8_t)c]);
             }
-        }
 
-        if (is_special) {
-            // special token should not contain whitespaces
-            // so here `subtext_` is identical to `subtext`
-            bert_token_t id = vocab.token_to_id_internal(subtext_);
-            if (id == BERTS_INVALID_TOKEN_ID) {
-                log::error("unknown special token: \"{}\"", subtext.encode());
+            if (!vocab.bpe->tokenize(symbols, result)) {
+                log::error("failed to tokenize: {}", piece);
                 return false;
             }
-            log::when(BERTS_LOG_DEBUG, [&]() {
-                log::debug("special token: {} ({})", subtext.encode(), id);
-            });
-            result.push_back(id);
-            continue;
+            if (cacheable) {
+                vocab.cache.insert(piece, std::span{result}.subspan(n));
+            }
         }
 
-        std::vector<unicode::ustr> ss{};
-        re.split(subtext, ss);
+        if (spans) {
+            piece_spans(vocab, offset + begin, piece.size(), std::span{result}.subspan(n), *spans);
+        }
+    }
 
-        std::vector<unicode::ustr> bpe_tokens{};
-        for (const auto &s : ss) {
-            // replace control chars
-            std::string token = s.encode();
-            std::vector<unicode::unic_t> token_{};
-            for (char c : token) {
-                token_.push_back(byte_encoder[c]);
-            }
+    return true;
+}
 
-            if (!vocab.bpe->tokenize(token_, bpe_tokens, bpe_cache)) {
-                log::error("failed to tokenize: {}", s.encode());
+static bool tokenize(const vocab &vocab,
+                     std::string_view text,
+                     std::vector<bert_token_t> &result,
+                     std::vector<berts_token_span> *spans) {
+    log::info("tokenization start");
+
+    // byte-level symbols of a piece, reused by all calls on this thread
+    thread_local std::vector<bert_token_t> symbols{};
+
+    // "<s>abc <mask>def</s>"
+    // -> "<s>", "abc", "<mask>", "def", "</s>"
+    token_matcher::match m;
+    for (size_t pos = 0; pos < text.size(); pos = m.begin + m.size) {
+        if (!vocab.special_matcher.find(text, pos, m)) {
+            if (!tokenize_plain(vocab, text.substr(pos), pos, symbols, result, spans)) {
                 return false;
             }
+            break;
         }
 
-        for (const auto &token : bpe_tokens) {
-            bert_token_t id = vocab.token_to_id_internal(token.encode());
-            if (id == BERTS_INVALID_TOKEN_ID) {
-                log::error("failed to tokenize: {}", token.encode());
-                return false;
-            }
-            result.push_back(id);
+        auto subtext = text.substr(pos, m.begin - pos);
+
+        // Mask token behave like a normal word, i.e. include the space before it
+        if (m.id == vocab.special.mask) {
+            // use unicode whitespaces
+            subtext = rstrip(subtext);
+        }
+
+        if (!tokenize_plain(vocab, subtext, pos, symbols, result, spans)) {
+            return false;
         }
+
+        log::when(BERTS_LOG_DEBUG, [&]() {
+            log::debug("special token: {} ({})", text.substr(m.begin, m.size), m.id);
+        });
+        result.push_back(m.id);
+        if (spans) spans->push_back({m.begin, m.begin + m.size});
     }
 
     log::debug("finish tokenization");
     return true;
 }
 
+// texts shorter than this are tokenized on one thread
+static constexpr size_t min_chunk_size = 64 * 1024;
+
+// "a| b": the previous piece ends at 'a' and ' b' starts a new piece in the pre-tokenizer,
+// and no special token or whitespace run lies across the boundary
+static inline bool is_chunk_boundary(std::string_view s, size_t i) {
+    auto is_graph = [](char c) { return 0x21 <= c && c <= 0x7e; };
+    auto is_alnum = [](char c) { return ('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z'); };
+    return s[i] == ' ' &&
+           0 < i && is_graph(s[i - 1]) &&
+           i + 1 < s.size() && is_alnum(s[i + 1]);
+}
+
 bool model::tokenize(const berts_context *ctx,
-                     const std::string &text,
-                     std::vector<bert_token_t> &out) const {
+                     std::string_view text,
+                     std::vector<bert_token_t> &out,
+                     std::vector<berts_token_span> *spans,
+                     int n_threads) const {
     (void)ctx;
 
-    std::string bos = vocab->bos_token();
-    std::string eos = vocab->eos_token();
-    std::string cls = vocab->cls_token();
-    std::string mask = vocab->mask_token();
-    std::string pad = vocab->pad_token();
-    std::string sep = vocab->sep_token();
-    std::string unk = vocab->unk_token();
+    const size_t n_chunks = n_threads <= 0 ? GGML_DEFAULT_N_THREADS : n_threads;
+    if (n_chunks == 1 || text.size() < 2 * min_chunk_size) {
+        return roberta::tokenize(*vocab, text, out, spans);
+    }
+
+    const auto chunks = parallel::split_chunks(
+        text,
+        n_chunks,
+        min_chunk_size,
+        is_chunk_boundary);
+
+    if (chunks.size() == 1) {
+        return roberta::tokenize(*vocab, text, out, spans);
+    }
 
-    std::unordered_set<std::string> never_split{bos, eos, cls, mask, pad, sep, unk};
+    std::vector<std::vector<bert_token_t>> results(chunks.size());
+    std::vector<std::vector<berts_token_span>> span_results(spans ? chunks.size() : 0);
+    std::atomic_bool ok{true};
+    parallel::parallel_for(chunks.size(), chunks.size(), [&](size_t i) {
+        if (!roberta::tokenize(*vocab, chunks[i], results[i], spans ? &span_results[i] : nullptr)) {
+            ok = false;
+        }
+    });
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        out.insert(out.end(), results[i].begin(), results[i].end());
+        if (spans) {
+            const size_t offset = chunks[i].data() - text.data();
+            for (const auto &span : span_results[i]) {
+                spans->push_back({span.begin + offset, span.end + offset});
+            }
+        }
+    }
+
+    return ok;
+}
 
-    return roberta::tokenize(*vocab, text, never_split, out);
+void model::tokenizer_cache_stats(berts_tokenizer_cache_stats &stats) const noexcept {
+    const auto s = vocab->cache.get_stats();
+    stats.hits = s.hits;
+    stats.misses = s.misses;
+    stats.entries = s.entries;
+    stats.capacity = s.capacity;
 }
 
 // copied from bert.cpp:get_context_buffer_size
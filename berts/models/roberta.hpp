@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <span>
 #include <vector>
 #include "berts/models/bert.hpp"
 #include "berts/models/bpe.hpp"
+#include "berts/models/token_matcher.hpp"
 
 namespace berts::roberta {
 
@@ -20,6 +23,12 @@ struct special_tokens {
 struct vocab : public internal::vocab_base2<vocab> {
     special_tokens special;
     std::unique_ptr<bpe> bpe;
+    // byte -> id of its byte-level symbol; BERTS_INVALID_TOKEN_ID if not in the vocab
+    std::array<bert_token_t, 256> byte_ids;
+    // pre-tokenized piece -> token ids, shared by calls and threads
+    berts::word_cache cache;
+    // special tokens and BERTS_KEY_TOKENIZER_NEVER_SPLIT, split from the text before pre-tokenization
+    berts::token_matcher special_matcher;
 
     vocab();
     vocab(size_t n);
@@ -36,15 +45,25 @@ struct vocab : public internal::vocab_base2<vocab> {
     
     bert_token_t token_to_id(const std::string &token) const noexcept;
 
-    std::string id_to_token_internal(bert_token_t token_id) const noexcept {
+    std::string_view id_to_token_internal(bert_token_t token_id) const noexcept {
         return inherited::id_to_token(token_id);
     }
     
-    bert_token_t token_to_id_internal(const std::string &token) const noexcept {
+    bert_token_t token_to_id_internal(std::string_view token) const noexcept {
         return inherited::token_to_id(token);
     }
 
+    /// @brief fill `byte_ids` from the tokens (and clear the cache)
+    void build_byte_ids();
+
+    /// @brief build `special_matcher` from `special` and the given ids
+    bool build_special_tokens(std::span<const bert_token_t> never_split_ids);
+
     bool init(berts_context *ctx, ggml_context *ggml, gguf_context *gguf);
+
+    size_t memory_size() const noexcept;
+
+    static size_t estimate_memory_size(size_t n_tokens, size_t n_bytes, size_t n_merges) noexcept;
 };
 
 struct model : public internal::model_berts<vocab, bert::weights> {
@@ -56,8 +75,12 @@ struct model : public internal::model_berts<vocab, bert::weights> {
     }
 
     bool tokenize(const berts_context *ctx,
-                  const std::string &text,
-                  std::vector<bert_token_t> &out) const override;
+                  std::string_view text,
+                  std::vector<bert_token_t> &out,
+                  std::vector<berts_token_span> *spans,
+                  int n_threads) const override;
+
+    void tokenizer_cache_stats(berts_tokenizer_cache_stats &stats) const noexcept override;
 
     internal::ggml_size_info get_context_buffer_size(
         size_t token_count,
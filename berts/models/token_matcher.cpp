@@ -0,0 +1,74 @@
+#include "berts/models/token_matcher.hpp"
+
+namespace berts {
+
+token_matcher::~token_matcher() {
+    clear();
+}
+
+bool token_matcher::build(std::span<const entry> tokens) {
+    clear();
+
+    bool any = false;
+    for (const auto &[token, id] : tokens) {
+        if (!token.empty()) {
+            first_[(uint8_t)token[0]] = true;
+            any = true;
+        }
+    }
+
+    if (!any) {
+        return true;
+    }
+
+    trie_ = trie::build_trie(tokens);
+    if (!trie_) {
+        first_.fill(false);
+        return false;
+    }
+
+    return true;
+}
+
+void token_matcher::clear() {
+    if (trie_) {
+        trie::free_trie(trie_);
+        trie_ = nullptr;
+    }
+    first_.fill(false);
+}
+
+bool token_matcher::find(std::string_view text, size_t pos, match &m) const noexcept {
+    if (!trie_) {
+        return false;
+    }
+
+    const auto root = trie::trie_root(trie_);
+    for (size_t i = pos, n = text.size(); i < n; ++i) {
+        if (!first_[(uint8_t)text[i]]) {
+            continue;
+        }
+        size_t len = 0;
+        const auto id = trie::search_trie_substr(root, text.substr(i), len);
+        if (id != BERTS_INVALID_TOKEN_ID) {
+            m = {i, len, id};
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bert_token_t token_matcher::exact(std::string_view token) const noexcept {
+    if (!trie_ || token.empty()) {
+        return BERTS_INVALID_TOKEN_ID;
+    }
+    const auto node = trie::search_node(trie::trie_root(trie_), token);
+    return node ? trie::trie_node_id(node) : BERTS_INVALID_TOKEN_ID;
+}
+
+size_t token_matcher::memory_size() const noexcept {
+    return trie::trie_memory_size(trie_);
+}
+
+} // namespace berts
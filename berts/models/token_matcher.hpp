@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <string_view>
+#include <utility>
+#include "berts/berts.h"
+#include "berts/models/trie.hpp"
+
+namespace berts {
+
+/**
+ * finds special (and added) tokens in text
+ *
+ * ---
+ * tokens are stored in a double-array trie, and the trie is walked only
+ * at the bytes which can start a token, so one pass over the text costs
+ * O(text length * max token length) for a fixed token set.
+ * the leftmost match is found first, and the longest token wins at the same position
+ * (same as `Trie.split` of transformers).
+ */
+struct token_matcher {
+    using entry = std::pair<std::string_view, bert_token_t>;
+
+    struct match {
+        size_t begin;
+        size_t size;
+        bert_token_t id;
+    };
+
+    token_matcher() = default;
+    token_matcher(const token_matcher &) = delete;
+    token_matcher &operator=(const token_matcher &) = delete;
+    ~token_matcher();
+
+    /// @brief replace the tokens; empty tokens are ignored
+    bool build(std::span<const entry> tokens);
+
+    void clear();
+
+    bool empty() const noexcept {
+        return trie_ == nullptr;
+    }
+
+    /// @brief find the first token in `text[pos:]`
+    /// @return `false` if not found
+    bool find(std::string_view text, size_t pos, match &m) const noexcept;
+
+    /// @return id of `token` if it is one of the tokens, otherwise BERTS_INVALID_TOKEN_ID
+    bert_token_t exact(std::string_view token) const noexcept;
+
+    /// @brief call `fn(piece, id)` for each token and each text between tokens in order;
+    ///        `id` is BERTS_INVALID_TOKEN_ID for the text between tokens (never empty)
+    /// @return `false` if `fn` returns `false`
+    template <typename Fn>
+    bool split(std::string_view text, Fn &&fn) const {
+        size_t pos = 0;
+        match m;
+        while (find(text, pos, m)) {
+            if (pos < m.begin && !fn(text.substr(pos, m.begin - pos), BERTS_INVALID_TOKEN_ID)) {
+                return false;
+            }
+            if (!fn(text.substr(m.begin, m.size), m.id)) {
+                return false;
+            }
+            pos = m.begin + m.size;
+        }
+        if (pos < text.size()) {
+            return fn(text.substr(pos), BERTS_INVALID_TOKEN_ID);
+        }
+        return true;
+    }
+
+    /// @brief approximate allocated bytes
+    size_t memory_size() const noexcept;
+
+  private:
+    trie::trie *trie_ = nullptr;
+    // bytes which some token starts with
+    std::array<bool, 256> first_{};
+};
+
+} // namespace berts
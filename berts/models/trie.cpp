@@ -1,183 +1,348 @@
 #include "berts/models/trie.hpp"
 #include <algorithm>
-#include <memory>
-#include <unordered_map>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace berts::unicode;
 
 namespace berts::trie {
 
-struct trie_node;
-
-using node_t = std::unique_ptr<trie_node>;
-
-struct trie_node {
-    bert_token_t id; // -1 if not in vacab
-    std::unordered_map<unic_t, node_t> children;
-
-    trie_node()
-        : id(-1)
-        , children() {}
-
-    trie_node(bert_token_t id)
-        : id(id)
-        , children() {}
-};
+//
+// double-array trie over UTF-8 bytes
+//
+// each node is a unit of the array; offsets are relative to the unit itself,
+// so that a `const trie_node *` can be walked without the array:
+//   child  = node + node->base + code   (code = byte + 1)
+//   parent = child - child->check       (child->check == 0 means the unit is not used)
+//
 
 struct trie {
-    node_t root;
-    trie()
-        : root(new trie_node()) {}
+    std::vector<trie_node> units;
 };
 
-static inline void add_str(trie_node *n, const ustr &s, bert_token_t id) {
-    if (s.empty()) return;
-
-    auto it = s.begin();
-    const auto end = s.end();
-
-    while (it != end) {
-        auto c = *it++;
-        auto nit = n->children.find(c);
-        if (nit == n->children.end()) {
-            // not found
-            auto nn = new trie_node{};
-            n->children.emplace(c, nn);
-            n = nn;
-        } else {
-            n = nit->second.get();
-        }
-    }
+static constexpr size_t n_codes = 257; // 0 (not used) + 256 bytes
 
-    n->id = id;
-}
-
-static inline const trie_node *find_node(const trie_node *n, const ustr &s) {
-    if (s.empty()) return nullptr;
+static constexpr uint8_t max_fails = 16;
 
-    auto it = s.begin();
-    const auto end = s.end();
+static inline uint32_t code_of(char c) noexcept {
+    return (uint32_t)(uint8_t)c + 1;
+}
 
-    while (it != end) {
-        auto c = *it++;
-        auto nit = n->children.find(c);
-        if (nit == n->children.end()) {
-            // not found
-            return nullptr;
+//
+// builder
+//
+
+namespace {
+
+using key_t = std::pair<std::string_view, bert_token_t>;
+
+// (code, [lo, hi) of keys)
+using children_t = std::vector<std::pair<uint32_t, std::pair<size_t, size_t>>>;
+
+struct builder {
+    std::vector<key_t> keys;
+    std::vector<trie_node> units;
+    std::vector<bool> used;
+    // failed trials of each free unit
+    std::vector<uint8_t> fails;
+    size_t max_base = 0;
+    // lowest index which may be free
+    size_t first_free = 1;
+
+    void reserve(size_t n) {
+        if (units.size() < n) {
+            const size_t size = std::max(n, units.size() * 2);
+            units.resize(size, trie_node{0, 0, BERTS_INVALID_TOKEN_ID});
+            used.resize(size, false);
+            fails.resize(size, 0);
         }
-        n = nit->second.get();
     }
 
-    return n;
-}
+    bool is_free(size_t index) {
+        reserve(index + 1);
+        return !used[index];
+    }
 
-static inline const trie_node *find_substr(const trie_node *n, const ustr &s, ustr &found, ustr &rest) {
-    if (s.empty()) return nullptr;
+    size_t find_base(const children_t &children) {
+        const uint32_t first = children.front().first;
+        for (size_t pos = first_free;; ++pos) {
+            if (!is_free(pos)) {
+                if (pos == first_free) {
+                    ++first_free;
+                }
+                continue;
+            }
+
+            // `pos` is the candidate for the first child
+            bool ok = first <= pos;
+            const size_t base = pos - first;
+            for (size_t i = 1, n = children.size(); ok && i < n; ++i) {
+                ok = is_free(base + children[i].first);
+            }
+            if (ok) {
+                return base;
+            }
+
+            // give up the unit which seems hard to fill; it stays as a hole
+            if (++fails[pos] >= max_fails) {
+                used[pos] = true;
+            }
+        }
+    }
 
-    const trie_node *last_found = nullptr;
+    void build(size_t node, size_t lo, size_t hi, size_t depth) {
+        if (lo < hi && keys[lo].first.size() == depth) {
+            // keys are sorted, so the key which ends here comes first
+            units[node].id = keys[lo].second;
+            ++lo;
+        }
 
-    auto it = s.begin();
-    const auto end = s.end();
+        children_t children;
+        for (size_t i = lo; i < hi;) {
+            const char c = keys[i].first[depth];
+            size_t j = i + 1;
+            while (j < hi && keys[j].first[depth] == c) {
+                ++j;
+            }
+            children.emplace_back(code_of(c), std::make_pair(i, j));
+            i = j;
+        }
 
-    std::vector<unic_t> found_{};
-    std::vector<unic_t> rest_{};
+        if (children.empty()) {
+            // transitions from a leaf must stay in the array
+            units[node].base = -(int32_t)node;
+            return;
+        }
 
-    while (it != end) {
-        auto c = *it;
-        auto nit = n->children.find(c);
+        const size_t base = find_base(children);
+        max_base = std::max(max_base, base);
+        units[node].base = (int32_t)base - (int32_t)node;
 
-        if (nit == n->children.end()) {
-            // not found
-            std::copy(it, end, std::back_inserter(rest_));
-            break;
+        for (const auto &[code, range] : children) {
+            const size_t child = base + code;
+            used[child] = true;
+            units[child].check = (int32_t)child - (int32_t)node;
         }
 
-        found_.push_back(c);
-        n = nit->second.get();
-        it += 1;
-
-        if (n->id != BERTS_INVALID_TOKEN_ID) {
-            last_found = n;
+        for (const auto &[code, range] : children) {
+            build(base + code, range.first, range.second, depth + 1);
         }
     }
 
-    found = ustr{found_};
-    rest = ustr{rest_};
+    trie *finish() {
+        // transitions from any node land on [1, max_base + n_codes)
+        units.resize(max_base + n_codes, trie_node{0, 0, BERTS_INVALID_TOKEN_ID});
+        units.shrink_to_fit();
+        trie *t = new trie{};
+        t->units = std::move(units);
+        return t;
+    }
+};
 
-    return last_found;
+} // namespace
+
+static trie *build(std::vector<key_t> &&keys) {
+    // the first token wins if duplicated
+    std::stable_sort(keys.begin(), keys.end(), [](const key_t &a, const key_t &b) {
+        return a.first < b.first;
+    });
+    keys.erase(std::unique(keys.begin(), keys.end(), [](const key_t &a, const key_t &b) {
+                   return a.first == b.first;
+               }),
+               keys.end());
+
+    builder b{};
+    b.keys = std::move(keys);
+    b.reserve(std::max(n_codes, b.keys.size() * 4));
+    b.used[0] = true; // root
+    b.build(0, 0, b.keys.size(), 0);
+    return b.finish();
 }
 
 trie *build_trie(const std::vector<std::string> &vocab) {
-    trie *t = new trie{};
+    std::vector<key_t> keys;
+    keys.reserve(vocab.size());
     for (size_t id = 0, n = vocab.size(); id < n; ++id) {
-        add_str(t->root.get(), {vocab[id]}, id);
+        if (!vocab[id].empty()) {
+            keys.emplace_back(vocab[id], (bert_token_t)id);
+        }
     }
-    return t;
+    return build(std::move(keys));
+}
+
+trie *build_trie(const flat_vocab &vocab) {
+    std::vector<key_t> keys;
+    keys.reserve(vocab.size());
+    for (size_t id = 0, n = vocab.size(); id < n; ++id) {
+        const auto token = vocab.at(id);
+        if (!token.empty()) {
+            keys.emplace_back(token, (bert_token_t)id);
+        }
+    }
+    return build(std::move(keys));
+}
+
+trie *build_trie(std::span<const std::pair<std::string_view, bert_token_t>> keys) {
+    std::vector<key_t> keys_;
+    keys_.reserve(keys.size());
+    for (const auto &[token, id] : keys) {
+        if (!token.empty()) {
+            keys_.emplace_back(token, id);
+        }
+    }
+    return build(std::move(keys_));
 }
 
 void free_trie(trie *t) {
     delete t;
 }
 
+size_t trie_memory_size(const trie *t) {
+    return t ? sizeof(trie) + t->units.capacity() * sizeof(trie_node) : 0;
+}
+
+size_t estimate_trie_unit_count(size_t n_bytes) {
+    // at most one unit per byte, and units are densely packed
+    return n_bytes + n_bytes / 8 + n_codes;
+}
+
+size_t estimate_trie_memory_size(size_t n_bytes) {
+    return sizeof(trie) + estimate_trie_unit_count(n_bytes) * sizeof(trie_node);
+}
+
+//
+// search
+//
+
 const trie_node *trie_root(const trie *t) {
-    return t->root.get();
+    return t->units.data();
 }
 
-bert_token_t search_trie(const trie *t, const std::string &s) {
-    return search_trie(t, ustr{s});
+size_t trie_unit_count(const trie *t) {
+    return t->units.size();
+}
+
+const trie_node *search_node(const trie_node *n, std::string_view s) noexcept {
+    if (s.empty()) return nullptr;
+
+    for (const char c : s) {
+        n = trie_next(n, c);
+        if (!n) {
+            return nullptr;
+        }
+    }
+
+    return n;
 }
 
-bert_token_t search_trie(const trie *t, const ustr &s) {
-    auto n = find_node(t->root.get(), s);
+bert_token_t search_trie_substr(const trie_node *n, std::string_view s, size_t &found_len) noexcept {
+    bert_token_t id = BERTS_INVALID_TOKEN_ID;
+
+    for (size_t i = 0, len = s.size(); i < len; ++i) {
+        n = trie_next(n, s[i]);
+        if (!n) {
+            break;
+        }
+        if (n->id != BERTS_INVALID_TOKEN_ID) {
+            id = n->id;
+            found_len = i + 1;
+        }
+    }
+
+    return id;
+}
+
+bert_token_t search_trie(const trie *t, const std::string &s) {
+    auto n = search_node(trie_root(t), std::string_view{s});
     return n ? n->id : BERTS_INVALID_TOKEN_ID;
 }
 
+bert_token_t search_trie(const trie *t, ustr_view s) {
+    return search_trie(t, s.encode());
+}
+
 const trie_node *search_node(const trie *t, const std::string &s) {
-    return search_node(t->root.get(), ustr{s});
+    return search_node(trie_root(t), std::string_view{s});
 }
 
-const trie_node *search_node(const trie *t, const ustr &s) {
-    return search_node(t->root.get(), s);
+const trie_node *search_node(const trie *t, ustr_view s) {
+    return search_node(trie_root(t), s);
 }
 
 const trie_node *search_node(const trie_node *n,
                              const std::string &s) {
-    return search_node(n, ustr{s});
+    return search_node(n, std::string_view{s});
 }
 
 const trie_node *search_node(const trie_node *n,
-                             const ustr &s) {
-    return find_node(n, s);
+                             ustr_view s) {
+    const auto s_ = s.encode();
+    return search_node(n, std::string_view{s_});
 }
 
 bert_token_t search_trie_substr(const trie *t, const std::string &s, std::string &found, std::string &rest) {
-    return search_trie_substr(t->root.get(), s, found, rest);
+    return search_trie_substr(trie_root(t), s, found, rest);
 }
 
 bert_token_t search_trie_substr(const trie *t, const ustr &s, ustr &found, ustr &rest) {
-    return search_trie_substr(t->root.get(), s, found, rest);
+    return search_trie_substr(trie_root(t), s, found, rest);
 }
 
 bert_token_t search_trie_substr(const trie_node *n, const std::string &s, std::string &found, std::string &rest) {
-    ustr s_{s}, found_{}, rest_{};
-    const auto id = search_trie_substr(n, s_, found_, rest_);
+    size_t found_len = 0;
+    const auto id = search_trie_substr(n, std::string_view{s}, found_len);
 
     if (id != BERTS_INVALID_TOKEN_ID) {
-        found = found_.encode();
-        rest = rest_.encode();
+        // `s` may be the same object as `found` or `rest`
+        std::string found_ = s.substr(0, found_len);
+        std::string rest_ = s.substr(found_len);
+        found = std::move(found_);
+        rest = std::move(rest_);
     }
 
     return id;
 }
 
 bert_token_t search_trie_substr(const trie_node *n, const ustr &s, ustr &found, ustr &rest) {
-    ustr found_{}, rest_{};
-    n = find_substr(n, s, found_, rest_);
+    ustr_view found_, rest_;
+    const auto id = search_trie_substr(n, s.view(), found_, rest_);
+
+    if (id != BERTS_INVALID_TOKEN_ID) {
+        // `s` may be the same object as `found` or `rest`
+        ustr found_copy{found_};
+        ustr rest_copy{rest_};
+        found = std::move(found_copy);
+        rest = std::move(rest_copy);
+    }
+
+    return id;
+}
+
+// number of UTF-16 code units of the UTF-8 string `s`
+static size_t utf16_length(std::string_view s) noexcept {
+    size_t n = 0;
+    for (const auto c : s) {
+        const auto b = (uint8_t)c;
+        if ((b & 0xf8) == 0xf0) {
+            n += 2; // surrogate pair
+        } else if ((b & 0xc0) != 0x80) {
+            n += 1;
+        }
+    }
+    return n;
+}
+
+bert_token_t search_trie_substr(const trie_node *n, ustr_view s, ustr_view &found, ustr_view &rest) {
+    const auto s_ = s.encode();
+    size_t found_len = 0;
+    const auto id = search_trie_substr(n, std::string_view{s_}, found_len);
 
-    const auto id = n ? n->id : BERTS_INVALID_TOKEN_ID;
     if (id != BERTS_INVALID_TOKEN_ID) {
-        found = found_;
-        rest = rest_;
+        const size_t k = utf16_length(std::string_view{s_}.substr(0, found_len));
+        found = s.substr(0, k);
+        rest = s.substr(k);
     }
 
     return id;
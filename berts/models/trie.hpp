@@ -1,39 +1,86 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "berts/berts.h"
+#include "berts/models/flat_vocab.hpp"
 #include "berts/models/unicode.hpp"
 
 namespace berts::trie {
 
 struct trie;
-struct trie_node;
+
+/// @brief a unit of the double-array; offsets are relative to the unit itself
+struct trie_node {
+    int32_t base;  // child = this + base + (byte + 1)
+    int32_t check; // parent = this - check; 0 if the unit is not used
+    bert_token_t id; // -1 if not in vocab
+};
 
 trie *build_trie(const std::vector<std::string> &vocab);
 
+trie *build_trie(const flat_vocab &vocab);
+
+/// @brief build a trie of (token, id) pairs; the first one wins if a token is duplicated
+trie *build_trie(std::span<const std::pair<std::string_view, bert_token_t>> keys);
+
 void free_trie(trie *t);
 
+/// @brief approximate bytes allocated by the trie
+size_t trie_memory_size(const trie *t);
+
+/// @brief approximate upper bound of units of a trie of tokens with `n_bytes` bytes (UTF-8) in total
+size_t estimate_trie_unit_count(size_t n_bytes);
+
+/// @brief approximate upper bound of bytes allocated by a trie of tokens with `n_bytes` bytes (UTF-8) in total
+size_t estimate_trie_memory_size(size_t n_bytes);
+
 const trie_node *trie_root(const trie *t);
 
+/// @brief number of units (nodes and holes) of the trie
+size_t trie_unit_count(const trie *t);
+
+/// @brief index of the unit in [0, trie_unit_count(t))
+inline size_t trie_node_index(const trie *t, const trie_node *n) noexcept {
+    return (size_t)(n - trie_root(t));
+}
+
+/// @brief follow the transition by one byte of UTF-8
+/// @return child node or `nullptr` if not found
+inline const trie_node *trie_next(const trie_node *n, char c) noexcept {
+    const trie_node *child = n + n->base + ((uint32_t)(uint8_t)c + 1);
+    return child->check != 0 && child - child->check == n ? child : nullptr;
+}
+
+/// @return token id of the node; -1 if the node is not in vocab
+inline bert_token_t trie_node_id(const trie_node *n) noexcept {
+    return n->id;
+}
+
 /// @return -1 if not found
 bert_token_t search_trie(const trie *t,
                          const std::string &s);
 
 bert_token_t search_trie(const trie *t,
-                         const unicode::ustr &s);
+                         unicode::ustr_view s);
 
 const trie_node *search_node(const trie *t,
                              const std::string &s);
 
 const trie_node *search_node(const trie *t,
-                             const unicode::ustr &s);
+                             unicode::ustr_view s);
 
 const trie_node *search_node(const trie_node *n,
                              const std::string &s);
 
 const trie_node *search_node(const trie_node *n,
-                             const unicode::ustr &s);
+                             unicode::ustr_view s);
+
+const trie_node *search_node(const trie_node *n,
+                             std::string_view s) noexcept;
 
 /// @brief search substr in vocab with greedy longest-match-first algorithm
 /// @param found [out] found substring
@@ -59,4 +106,17 @@ bert_token_t search_trie_substr(const trie_node *n,
                                 unicode::ustr &found,
                                 unicode::ustr &rest);
 
+/// @brief same as above, but `found` and `rest` are slices of `s`
+bert_token_t search_trie_substr(const trie_node *n,
+                                unicode::ustr_view s,
+                                unicode::ustr_view &found,
+                                unicode::ustr_view &rest);
+
+/// @brief search the longest prefix of `s` in vocab without copying
+/// @param found_len [out] length in bytes of the found prefix (untouched if not found)
+/// @return bert_token_id of the prefix; -1 if not found
+bert_token_t search_trie_substr(const trie_node *n,
+                                std::string_view s,
+                                size_t &found_len) noexcept;
+
 } // namespace berts::trie
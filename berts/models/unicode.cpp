@@ -1,6 +1,7 @@
 #include "berts/models/unicode.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cstring>
 #include <iterator>
 #include <sstream>
@@ -13,11 +14,16 @@
 #include <icu.h>
 #else
 #include <unicode/uclean.h>
+#include <unicode/ucasemap.h>
 #include <unicode/unorm2.h>
 #include <unicode/ustring.h>
 #include "unicode.hpp"
 #endif
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
 namespace berts::unicode {
 
 static inline bool check_uerror_(UErrorCode e, const char *func, int lineno) {
@@ -30,86 +36,6 @@ static inline bool check_uerror_(UErrorCode e, const char *func, int lineno) {
 
 #define check_uerror(e) check_uerror_((e), __func__, __LINE__)
 
-struct ustr_impl {
-    // in ICU lib, int32_t is used as a size type
-    using size_type = int32_t;
-
-    UChar *str;
-    size_type size;
-    UErrorCode e;
-
-    ustr_impl()
-        : str(nullptr)
-        , e(U_ZERO_ERROR) {}
-
-    ~ustr_impl() {
-        free();
-    }
-
-    ustr_impl(const ustr_impl &other)
-        : ustr_impl() {
-        if (other.str) {
-            alloc(other.size);
-            std::copy(other.str, other.str + other.size, str);
-        }
-        e = other.e;
-    }
-
-    ustr_impl(ustr_impl &&other) noexcept
-        : str(other.str)
-        , size(other.size)
-        , e(other.e) {
-        other.str = nullptr;
-        other.size = 0;
-        other.e = U_ZERO_ERROR;
-    }
-
-    ustr_impl &operator=(const ustr_impl &other) {
-        if (this != &other) {
-            free();
-            if (other.str) {
-                alloc(other.size);
-                std::copy(other.str, other.str + other.size, str);
-            }
-            e = other.e;
-        }
-        return *this;
-    }
-
-    ustr_impl &operator=(ustr_impl &&other) noexcept {
-        if (this != &other) {
-            free();
-            str = other.str;
-            size = other.size;
-            e = other.e;
-            other.str = nullptr;
-            other.size = 0;
-            other.e = U_ZERO_ERROR;
-        }
-        return *this;
-    }
-
-    void alloc() {
-        alloc(size);
-    }
-
-    void alloc(size_type new_size) {
-        free();
-        if (new_size != 0) {
-            str = new UChar[new_size];
-        }
-        size = new_size;
-    }
-
-    void free() {
-        if (str) {
-            delete[] str;
-            str = nullptr;
-        }
-        size = 0;
-    }
-};
-
 #if 0
 // ref. https://qiita.com/tomolatoon/items/3e14a3172261230ebe83
 template <bool IsConst>
@@ -248,52 +174,109 @@ static_assert(requires(
 });
 #endif
 
-ustr::ustr()
-    : impl(new ustr_impl{}) {}
+//
+// ustr_view
+//
+
+size_t ustr_view::codepoints() const {
+    if (len == 0) return 0;
+    return (size_t)u_countChar32(str, (int32_t)len);
+}
+
+bool ustr_view::encode_to(std::string &out) const {
+    out.clear();
+    if (len == 0) return true;
+
+    // one UTF-16 code unit takes 3 bytes at most in UTF-8
+    out.resize(len * 3);
+    UErrorCode e = U_ZERO_ERROR;
+    int32_t size = 0;
+    u_strToUTF8(out.data(), (int32_t)out.size(), &size, str, (int32_t)len, &e);
+    if (U_FAILURE(e)) {
+        out.clear();
+        return false;
+    }
+    out.resize(size);
+    return true;
+}
+
+std::string ustr_view::encode() const {
+    std::string s{};
+    encode_to(s);
+    return s;
+}
+
+//
+// ustr
+//
 
 ustr::ustr(const char *in)
     : ustr(in, std::strlen(in)) {}
 
 ustr::ustr(const char *in, size_t size)
     : ustr() {
-    u_strFromUTF8(nullptr, 0, &impl->size, in, size, &impl->e);
-    if (!U_SUCCESS(impl->e) && impl->e != U_BUFFER_OVERFLOW_ERROR) return;
-    impl->e = U_ZERO_ERROR;
-    impl->alloc();
-    u_strFromUTF8(impl->str, impl->size, nullptr, in, size, &impl->e);
+    // short strings are converted into the inline buffer directly
+    UErrorCode e = U_ZERO_ERROR;
+    int32_t n = 0;
+    u_strFromUTF8(str_, capacity_, &n, in, (int32_t)size, &e);
+    if (e == U_BUFFER_OVERFLOW_ERROR) {
+        e = U_ZERO_ERROR;
+        alloc(n);
+        u_strFromUTF8(str_, capacity_, &n, in, (int32_t)size, &e);
+    }
+    size_ = U_SUCCESS(e) ? n : 0;
+    e_ = e;
 }
 
 ustr::ustr(const unic_t *in, size_t count)
     : ustr() {
-    impl->alloc(count);
-    std::copy(in, in + count, impl->str);
+    alloc(count);
+    std::copy(in, in + count, str_);
 }
 
 ustr::ustr(const unic32_t *in, size_t count)
     : ustr() {
-    u_strFromUTF32(nullptr, 0, &impl->size, in, count, &impl->e);
-    if (!U_SUCCESS(impl->e) && impl->e != U_BUFFER_OVERFLOW_ERROR) return;
-    impl->e = U_ZERO_ERROR;
-    impl->alloc();
-    u_strFromUTF32(impl->str, impl->size, nullptr, in, count, &impl->e);
+    UErrorCode e = U_ZERO_ERROR;
+    int32_t n = 0;
+    u_strFromUTF32(str_, capacity_, &n, in, (int32_t)count, &e);
+    if (e == U_BUFFER_OVERFLOW_ERROR) {
+        e = U_ZERO_ERROR;
+        alloc(n);
+        u_strFromUTF32(str_, capacity_, &n, in, (int32_t)count, &e);
+    }
+    size_ = U_SUCCESS(e) ? n : 0;
+    e_ = e;
 }
 
-// ustr::ustr(const std::string &in)
-//     : ustr(in.c_str(), in.size()) {}
-
 ustr::ustr(const ustr &in)
     : ustr() {
-    *impl = *in.impl;
+    *this = in;
 }
 
 ustr::ustr(ustr &&in) noexcept
     : ustr() {
-    *impl = std::move(*in.impl);
+    *this = std::move(in);
+}
+
+void ustr::alloc(size_t size) {
+    if ((size_t)capacity_ < size) {
+        if (str_ != buf_) {
+            delete[] str_;
+        }
+        str_ = new unic_t[size];
+        capacity_ = (int32_t)size;
+    }
+    size_ = (int32_t)size;
 }
 
 void ustr::dispose() {
-    impl->free();
-    impl->e = U_ZERO_ERROR;
+    if (str_ != buf_) {
+        delete[] str_;
+        str_ = buf_;
+        capacity_ = inline_capacity;
+    }
+    size_ = 0;
+    e_ = U_ZERO_ERROR;
 }
 
 ustr::~ustr() {
@@ -301,145 +284,92 @@ ustr::~ustr() {
 }
 
 ustr &ustr::operator=(const ustr &in) {
-    *impl = *in.impl;
+    if (this != &in) {
+        alloc(in.size_);
+        std::copy(in.str_, in.str_ + in.size_, str_);
+        e_ = in.e_;
+    }
     return *this;
 }
 
 ustr &ustr::operator=(ustr &&in) noexcept {
-    *impl = std::move(*in.impl);
-    return *this;
-}
-
-ustr ustr::operator+(const ustr &rhs) const {
-    const auto lstr = impl->str;
-    const auto lsize = impl->size;
-    const auto rstr = rhs.impl->str;
-    const auto rsize = rhs.impl->size;
-
-    ustr s{};
-    s.impl->alloc(lsize + rsize);
-    const auto sstr = s.impl->str;
-
-    if (lsize != 0) {
-        std::copy(lstr, lstr + lsize, sstr);
-    }
-    if (rsize != 0) {
-        std::copy(rstr, rstr + rsize, sstr + lsize);
-    }
-
-    return s;
-}
-
-ustr &ustr::operator+=(const ustr &rhs) {
-    if (rhs.impl->size == 0) {
+    if (this == &in) {
         return *this;
     }
 
-    if (impl->size == 0) {
-        *impl = *rhs.impl;
-        return *this;
+    if (in.str_ != in.buf_) {
+        // take the heap buffer
+        dispose();
+        str_ = in.str_;
+        capacity_ = in.capacity_;
+        in.str_ = in.buf_;
+        in.capacity_ = inline_capacity;
+        size_ = in.size_;
+    } else {
+        // fits in the inline buffer or the current heap buffer
+        size_ = in.size_;
+        std::copy(in.str_, in.str_ + in.size_, str_);
     }
+    e_ = in.e_;
 
-    // If rhs is *this, impl->alloc will break rhs's buffer
-    // so buffer must be copied first.
-
-    ustr result = *this + rhs;
-    *this = result;
+    in.size_ = 0;
+    in.e_ = U_ZERO_ERROR;
 
     return *this;
 }
 
-bool ustr::operator==(const ustr &rhs) const {
-    if (impl->size != rhs.impl->size) {
-        return false;
-    }
-
-    if (impl->size == 0) {
-        return true;
-    }
-
-    return std::memcmp(impl->str, rhs.impl->str, impl->size * sizeof(UChar)) == 0;
+ustr ustr::operator+(ustr_view rhs) const {
+    ustr s{};
+    s.alloc(size_ + rhs.size());
+    std::copy(str_, str_ + size_, s.str_);
+    std::copy(rhs.begin(), rhs.end(), s.str_ + size_);
+    return s;
 }
 
-std::strong_ordering ustr::operator<=>(const ustr &rhs_) const {
-    // a <=> b
-    //   a <  b <-> < 0
-    //   a == b <-> = 0
-    //   a  > b <-> > 0
-
-    using o = std::strong_ordering;
-
-    const auto lhs_size = impl->size;
-    const auto rhs_size = rhs_.impl->size;
-    const auto lhs = impl->str;
-    const auto rhs = rhs_.impl->str;
-
-    if (lhs_size == 0) {
-        // "" <=> ""
-        // "" <=> "a"
-        return rhs_size == 0 ? o::equal : o::less;
+ustr &ustr::operator+=(ustr_view rhs) {
+    if (rhs.empty()) {
+        return *this;
     }
 
-    if (rhs_size == 0) {
-        // "a" <=> ""
-        return o::greater;
+    const size_t new_size = size_ + rhs.size();
+    if (new_size <= (size_t)capacity_) {
+        // `rhs` may be a view of *this, but it never overlaps with the appended range
+        std::copy(rhs.begin(), rhs.end(), str_ + size_);
+        size_ = (int32_t)new_size;
+        return *this;
     }
 
-    for (ustr_impl::size_type i = 0; i < lhs_size; ++i) {
-        if (rhs_size <= i) {
-            // "abc" <=> "a"
-            return o::greater;
-        }
-        const auto l = lhs[i];
-        const auto r = rhs[i];
-        if (l != r) return l <=> r;
-    }
+    *this = *this + rhs;
 
-    // "abc" <=> "abc"
-    // "a" <=> "abc"
-    return lhs_size == rhs_size ? o::equal : o::less;
+    return *this;
 }
 
 bool ustr::ok() const {
-    return U_SUCCESS(impl->e);
-}
-
-bool ustr::empty() const {
-    return !impl->str;
+    return U_SUCCESS((UErrorCode)e_);
 }
 
 std::string ustr::encode() const {
-    if (empty()) return "";
-
-    std::string s{};
-    int32_t size;
-    u_strToUTF8(nullptr, 0, &size, impl->str, impl->size, &impl->e);
-    if (!U_SUCCESS(impl->e) && impl->e != U_BUFFER_OVERFLOW_ERROR) return "";
-    impl->e = U_ZERO_ERROR;
-    s.resize(size);
-    u_strToUTF8(s.data(), s.size(), nullptr, impl->str, impl->size, &impl->e);
-    return s;
+    return view().encode();
 }
 
 size_t ustr::bytesize() const {
-    return impl->size * 2;
+    return size_ * 2;
 }
 
 size_t ustr::packsize() const {
-    return impl->size;
+    return size_;
 }
 
 size_t ustr::codepoints() const {
-    if (!impl->str || impl->size == 0) return 0;
-    return (size_t)u_countChar32(impl->str, impl->size);
+    return view().codepoints();
 }
 
 void ustr::pack_to(unic_t *buffer) const {
-    std::copy(impl->str, impl->str + impl->size, buffer);
+    std::copy(str_, str_ + size_, buffer);
 }
 
 void ustr::pack_to(std::vector<unic_t> &buffer) const {
-    std::copy(impl->str, impl->str + impl->size, std::back_inserter(buffer));
+    buffer.insert(buffer.end(), str_, str_ + size_);
 }
 
 void ustr::pack_to(std::vector<unic32_t> &buffer) const {
@@ -449,26 +379,15 @@ void ustr::pack_to(std::vector<unic32_t> &buffer) const {
 }
 
 unic_t ustr::operator[](size_t index) const {
-    if (index < (size_t)impl->size) {
-        return impl->str[index];
-    } else {
-        return (unic_t)0xfffd;
-    }
+    return view()[index];
 }
 
-bool ustr::starts_with(const ustr &prefix) const {
-    if (impl->size < prefix.impl->size) {
-        return false;
-    }
-    return std::memcmp(impl->str, prefix.impl->str, prefix.impl->size) == 0;
+bool ustr::starts_with(ustr_view prefix) const {
+    return view().starts_with(prefix);
 }
 
-bool ustr::ends_with(const ustr &suffix) const {
-    if (impl->size < suffix.impl->size) {
-        return false;
-    }
-    size_t index = impl->size - suffix.impl->size;
-    return std::memcmp(impl->str + index, suffix.impl->str, suffix.impl->size) == 0;
+bool ustr::ends_with(ustr_view suffix) const {
+    return view().ends_with(suffix);
 }
 
 ustr ustr::lstrip() const {
@@ -502,11 +421,11 @@ ustr ustr::rstrip() const {
 }
 
 unic_t *ustr::begin() const {
-    return impl->str;
+    return str_;
 }
 
 unic_t *ustr::end() const {
-    return impl->str ? (impl->str + impl->size) : nullptr;
+    return str_ + size_;
 }
 
 bool normalize_nfc(const ustr &in, ustr &out) {
@@ -515,10 +434,10 @@ bool normalize_nfc(const ustr &in, ustr &out) {
     if (!check_uerror(e)) return false;
 
     UErrorCode e1 = U_ZERO_ERROR;
-    auto len = unorm2_normalize(k, in.impl->str, in.impl->size, nullptr, 0, &e1);
-    out.impl->alloc(len);
+    auto len = unorm2_normalize(k, in.str_, in.size_, nullptr, 0, &e1);
+    out.alloc(len);
 
-    unorm2_normalize(k, in.impl->str, in.impl->size, out.impl->str, out.impl->size, &e);
+    unorm2_normalize(k, in.str_, in.size_, out.str_, out.size_, &e);
 
     return check_uerror(e);
 }
@@ -529,42 +448,14 @@ bool normalize_nfd(const ustr &in, ustr &out) {
     if (!check_uerror(e)) return false;
 
     UErrorCode e1 = U_ZERO_ERROR;
-    auto len = unorm2_normalize(k, in.impl->str, in.impl->size, nullptr, 0, &e1);
-    out.impl->alloc(len);
+    auto len = unorm2_normalize(k, in.str_, in.size_, nullptr, 0, &e1);
+    out.alloc(len);
 
-    unorm2_normalize(k, in.impl->str, in.impl->size, out.impl->str, out.impl->size, &e);
+    unorm2_normalize(k, in.str_, in.size_, out.str_, out.size_, &e);
 
     return check_uerror(e);
 }
 
-bool is_whitespace(unic32_t c) {
-    // doc says:
-    //   true for U+0009 (TAB) and characters with general category "Zs" (space separators).
-    // we treat '\t' as a whitespace, so everything is ok.
-    return u_isblank(c);
-}
-
-bool is_control(unic32_t c) {
-    // doc says:
-    //   True for general categories <em>other</em> than "C" (controls).
-    return !u_isprint(c);
-}
-
-bool is_punct(unic32_t c) {
-    // according to transformers, we treat all
-    // non-letter/number ASCII as punctuation
-    // such as "^", "$", and "`"
-
-    if ((c >= 33 && c <= 47) ||
-        (c >= 58 && c <= 64) ||
-        (c >= 91 && c <= 96) ||
-        (c >= 123 && c <= 126))
-        return true;
-
-    const std::string k = category(c);
-    return k.size() != 0 && k[0] == 'P';
-}
-
 const char *category(unic32_t c) {
     auto k = u_charType(c);
     switch (k) {
@@ -603,28 +494,297 @@ const char *category(unic32_t c) {
 }
 
 bool is_category(unic32_t c, const char *cat) {
-    const std::string k = category(c);
-    return k == cat;
+    return std::strcmp(category(c), cat) == 0;
 }
 
 bool to_lower(const ustr &in, ustr &out) {
     out.dispose();
-    auto size = u_strToLower(nullptr, 0, in.impl->str, in.impl->size, "", &in.impl->e);
-    if (!U_SUCCESS(in.impl->e)) return false;
-    out.impl->alloc(size);
-    u_strToLower(out.impl->str, out.impl->size, in.impl->str, in.impl->size, "", &out.impl->e);
+    // preflighting reports U_BUFFER_OVERFLOW_ERROR
+    UErrorCode e = U_ZERO_ERROR;
+    auto size = u_strToLower(nullptr, 0, in.str_, in.size_, "", &e);
+    if (U_FAILURE(e) && e != U_BUFFER_OVERFLOW_ERROR) return false;
+    out.alloc(size);
+    e = U_ZERO_ERROR;
+    u_strToLower(out.str_, out.size_, in.str_, in.size_, "", &e);
+    out.e_ = e;
     return out.ok();
 }
 
 bool to_upper(const ustr &in, ustr &out) {
     out.dispose();
-    auto size = u_strToUpper(nullptr, 0, in.impl->str, in.impl->size, "", &in.impl->e);
-    if (!U_SUCCESS(in.impl->e)) return false;
-    out.impl->alloc(size);
-    u_strToUpper(out.impl->str, out.impl->size, in.impl->str, in.impl->size, "", &out.impl->e);
+    UErrorCode e = U_ZERO_ERROR;
+    auto size = u_strToUpper(nullptr, 0, in.str_, in.size_, "", &e);
+    if (U_FAILURE(e) && e != U_BUFFER_OVERFLOW_ERROR) return false;
+    out.alloc(size);
+    e = U_ZERO_ERROR;
+    u_strToUpper(out.str_, out.size_, in.str_, in.size_, "", &e);
+    out.e_ = e;
     return out.ok();
 }
 
+//
+// UTF-8
+//
+
+size_t ascii_span(std::string_view s) noexcept {
+    const char *p = s.data();
+    const size_t n = s.size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 32 <= n; i += 32) {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+        const auto mask = (uint32_t)_mm256_movemask_epi8(v);
+        if (mask != 0) {
+            return i + std::countr_zero(mask);
+        }
+    }
+#endif
+
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        const auto mask = (uint32_t)_mm_movemask_epi8(v);
+        if (mask != 0) {
+            return i + std::countr_zero(mask);
+        }
+    }
+#endif
+
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; i + 8 <= n; i += 8) {
+            uint64_t w;
+            std::memcpy(&w, p + i, 8);
+            const uint64_t mask = w & 0x8080808080808080ULL;
+            if (mask != 0) {
+                return i + std::countr_zero(mask) / 8;
+            }
+        }
+    }
+
+    for (; i < n; ++i) {
+        if ((unsigned char)p[i] >= 0x80) {
+            return i;
+        }
+    }
+
+    return n;
+}
+
+static thread_local std::vector<UChar> utf16_buf0, utf16_buf1;
+
+static bool utf8_to_utf16(std::string_view in, std::vector<UChar> &out) {
+    // UTF-16 code units <= UTF-8 bytes
+    out.resize(std::max<size_t>(in.size(), 1));
+    int32_t len = 0;
+    UErrorCode e = U_ZERO_ERROR;
+    u_strFromUTF8WithSub(out.data(), (int32_t)out.size(), &len, in.data(), (int32_t)in.size(), 0xfffd, nullptr, &e);
+    if (!check_uerror(e)) return false;
+    out.resize(len);
+    return true;
+}
+
+static bool utf16_to_utf8(const std::vector<UChar> &in, std::string &out) {
+    // UTF-8 bytes <= 3 * UTF-16 code units
+    out.resize(std::max<size_t>(in.size() * 3, 1));
+    int32_t len = 0;
+    UErrorCode e = U_ZERO_ERROR;
+    u_strToUTF8WithSub(out.data(), (int32_t)out.size(), &len, in.data(), (int32_t)in.size(), 0xfffd, nullptr, &e);
+    if (!check_uerror(e)) return false;
+    out.resize(len);
+    return true;
+}
+
+static bool normalize(const UNormalizer2 *k, std::string_view in, std::string &out) {
+    auto &src = utf16_buf0;
+    auto &dst = utf16_buf1;
+
+    if (!utf8_to_utf16(in, src)) return false;
+
+    dst.resize(std::max<size_t>(src.size() * 2, 16));
+    UErrorCode e = U_ZERO_ERROR;
+    auto len = unorm2_normalize(k, src.data(), (int32_t)src.size(), dst.data(), (int32_t)dst.size(), &e);
+    if (e == U_BUFFER_OVERFLOW_ERROR) {
+        e = U_ZERO_ERROR;
+        dst.resize(len);
+        len = unorm2_normalize(k, src.data(), (int32_t)src.size(), dst.data(), (int32_t)dst.size(), &e);
+    }
+    if (!check_uerror(e)) return false;
+    dst.resize(len);
+
+    return utf16_to_utf8(dst, out);
+}
+
+// a code point which is not `unsafe` is a normalization boundary:
+// the text before it and the text from it are normalized independently
+static inline bool is_safe(std::string_view s, size_t &i, uint16_t unsafe) noexcept {
+    const size_t start = i;
+    const auto c = decode_utf8(s, i);
+    if (c == 0xfffd && s.compare(start, i - start, "\xef\xbf\xbd") != 0) {
+        // ill-formed sequences are replaced by the normalizer
+        return false;
+    }
+    return !(properties(c) & unsafe);
+}
+
+// start of the last boundary before the first unsafe code point, or `s.size()` if none
+static size_t quick_check_span(std::string_view s, uint16_t unsafe) noexcept {
+    size_t boundary = 0;
+    for (size_t i = 0, n = s.size(); i < n;) {
+        if ((unsigned char)s[i] < 0x80) {
+            // ASCII is always safe
+            i += ascii_span(s.substr(i));
+            boundary = i - 1;
+            continue;
+        }
+        const size_t start = i;
+        if (!is_safe(s, i, unsafe)) {
+            return boundary;
+        }
+        boundary = start;
+    }
+    return s.size();
+}
+
+// normalize only the maximal spans which fail the quick check
+static bool normalize_spans(const UNormalizer2 *k, uint16_t unsafe, std::string_view in, std::string &out) {
+    static thread_local std::string buf;
+
+    const size_t n = in.size();
+    size_t begin = quick_check_span(in, unsafe);
+    out.assign(in.substr(0, begin));
+
+    while (begin < n) {
+        // [begin, end) fails; it starts at a boundary and ends before the next safe code point
+        size_t end = begin;
+        decode_utf8(in, end);
+        while (end < n) {
+            size_t i = end;
+            if (is_safe(in, i, unsafe)) break;
+            end = i;
+        }
+
+        if (!normalize(k, in.substr(begin, end - begin), buf)) return false;
+        out += buf;
+
+        const size_t rest = quick_check_span(in.substr(end), unsafe);
+        out += in.substr(end, rest);
+        begin = end + rest;
+    }
+
+    return true;
+}
+
+bool normalize_nfc(std::string_view in, std::string &out) {
+    UErrorCode e = U_ZERO_ERROR;
+    auto k = unorm2_getNFCInstance(&e);
+    if (!check_uerror(e)) return false;
+    return normalize_spans(k, tables::PROP_NFC_UNSAFE, in, out);
+}
+
+bool normalize_nfd(std::string_view in, std::string &out) {
+    UErrorCode e = U_ZERO_ERROR;
+    auto k = unorm2_getNFDInstance(&e);
+    if (!check_uerror(e)) return false;
+    return normalize_spans(k, tables::PROP_NFD_UNSAFE, in, out);
+}
+
+bool is_nfc(std::string_view s) noexcept {
+    return quick_check_span(s, tables::PROP_NFC_UNSAFE) == s.size();
+}
+
+bool is_nfd(std::string_view s) noexcept {
+    return quick_check_span(s, tables::PROP_NFD_UNSAFE) == s.size();
+}
+
+bool to_lower(std::string_view in, std::string &out) {
+    static const auto csm = []() -> UCaseMap * {
+        UErrorCode e = U_ZERO_ERROR;
+        auto csm = ucasemap_open("", U_FOLD_CASE_DEFAULT, &e);
+        return check_uerror(e) ? csm : nullptr;
+    }();
+    if (!csm) return false;
+
+    // full case mapping may expand (e.g. U+0130 -> i + U+0307)
+    out.resize(std::max<size_t>(in.size() + in.size() / 2, 16));
+    UErrorCode e = U_ZERO_ERROR;
+    auto len = ucasemap_utf8ToLower(csm, out.data(), (int32_t)out.size(), in.data(), (int32_t)in.size(), &e);
+    if (e == U_BUFFER_OVERFLOW_ERROR) {
+        e = U_ZERO_ERROR;
+        out.resize(len);
+        len = ucasemap_utf8ToLower(csm, out.data(), (int32_t)out.size(), in.data(), (int32_t)in.size(), &e);
+    }
+    if (!check_uerror(e)) return false;
+    out.resize(len);
+    return true;
+}
+
+static bool lower_strip_accents_slow(std::string_view in, std::string &out) {
+    static thread_local std::string lower, nfd;
+
+    if (!to_lower(in, lower)) return false;
+    if (!normalize_nfd(lower, nfd)) return false;
+
+    std::string &stripped = lower;
+    stripped.clear();
+    for (size_t i = 0, n = nfd.size(); i < n;) {
+        const size_t start = i;
+        const auto c = decode_utf8(nfd, i);
+        if (!is_nonspacing_mark(c)) {
+            stripped.append(nfd, start, i - start);
+        }
+    }
+
+    return normalize_nfc(stripped, out);
+}
+
+bool lower_strip_accents(std::string_view in, std::string &out) {
+    static thread_local std::string tmp;
+
+    // GREEK CAPITAL LETTER SIGMA depends on the context (final sigma)
+    if (in.find("\xce\xa3") != std::string_view::npos) {
+        return lower_strip_accents_slow(in, out);
+    }
+
+    out.clear();
+    bool nfc = true;
+
+    for (size_t i = 0, n = in.size(); i < n;) {
+        const auto b = (unsigned char)in[i];
+        if (b < 0x80) {
+            out += ('A' <= b && b <= 'Z') ? (char)(b + ('a' - 'A')) : (char)b;
+            ++i;
+            continue;
+        }
+
+        const size_t start = i;
+        const auto c = decode_utf8(in, i);
+        if (c == 0xfffd && in.compare(start, i - start, "\xef\xbf\xbd") != 0) {
+            // ICU replaces ill-formed sequences in its own way
+            return lower_strip_accents_slow(in, out);
+        }
+
+        std::string_view folded;
+        if (!fold_lower_strip(c, folded)) {
+            folded = in.substr(start, i - start);
+        }
+        out += folded;
+
+        for (size_t k = 0, m = folded.size(); nfc && k < m;) {
+            nfc = !is_nfc_unsafe(decode_utf8(folded, k));
+        }
+    }
+
+    // each folded piece is NFC, but the concatenation may not be
+    // (e.g. a combining mark which was not removed follows a folded char)
+    if (!nfc) {
+        if (!normalize_nfc(out, tmp)) return false;
+        out.swap(tmp);
+    }
+
+    return true;
+}
+
 regex::regex()
     : impl(nullptr) {
     UChar dummy{0};
@@ -639,7 +799,7 @@ regex::regex()
 regex::regex(const ustr &pattern)
     : impl(nullptr) {
     UErrorCode e = U_ZERO_ERROR;
-    impl = uregex_open(pattern.impl->str, pattern.impl->size, 0, nullptr, &e);
+    impl = uregex_open(pattern.str_, pattern.size_, 0, nullptr, &e);
     if (!check_uerror(e)) {
         impl = nullptr;
     }
@@ -667,14 +827,14 @@ regex &regex::operator=(regex &&other) {
     return *this;
 }
 
-bool regex::test(const ustr &str) {
+bool regex::test(ustr_view str) {
     if (!impl) return false;
 
     auto pattern = (URegularExpression *)impl;
 
     UErrorCode e = U_ZERO_ERROR;
 
-    uregex_setText(pattern, str.impl->str, str.impl->size, &e);
+    uregex_setText(pattern, str.data(), (int32_t)str.size(), &e);
     if (!check_uerror(e)) return false;
 
     uregex_reset(pattern, 0, &e);
@@ -687,14 +847,12 @@ bool regex::test(const ustr &str) {
     return false;
 }
 
-size_t regex::split(const ustr &str, std::vector<ustr> &out) {
-    if (!impl) return false;
-
-    auto pattern = (URegularExpression *)impl;
-
+// call `fn(begin, length)` for each piece of `str` (matches and the text between them)
+template <typename Fn>
+static size_t split_impl(URegularExpression *pattern, ustr_view str, Fn &&fn) {
     UErrorCode e = U_ZERO_ERROR;
 
-    uregex_setText(pattern, str.impl->str, str.impl->size, &e);
+    uregex_setText(pattern, str.data(), (int32_t)str.size(), &e);
     if (!check_uerror(e)) return false;
 
     uregex_reset(pattern, 0, &e);
@@ -715,7 +873,7 @@ size_t regex::split(const ustr &str, std::vector<ustr> &out) {
         if (!check_uerror(e)) return false;
 
         /**
-         * str.impl->str
+         * str.data()
          * |
          * v
          * text_text_text_text_text_text
@@ -725,22 +883,38 @@ size_t regex::split(const ustr &str, std::vector<ustr> &out) {
          */
 
         if (current < start) {
-            out.emplace_back(str.impl->str + current, start - current);
+            fn(current, start - current);
             added += 1;
         }
 
-        out.emplace_back(str.impl->str + start, end - start);
+        fn(start, end - start);
         added += 1;
 
         current = end;
     }
 
-    if (current < str.impl->size) {
-        out.emplace_back(str.impl->str + current, str.impl->size - current);
+    if ((size_t)current < str.size()) {
+        fn(current, (int32_t)str.size() - current);
         added += 1;
     }
 
     return added;
 }
 
+size_t regex::split(const ustr &str, std::vector<ustr> &out) {
+    if (!impl) return false;
+
+    return split_impl((URegularExpression *)impl, str, [&str, &out](int32_t begin, int32_t size) {
+        out.emplace_back(str.str_ + begin, (size_t)size);
+    });
+}
+
+size_t regex::split(ustr_view str, std::vector<ustr_view> &out) {
+    if (!impl) return false;
+
+    return split_impl((URegularExpression *)impl, str, [&str, &out](int32_t begin, int32_t size) {
+        out.push_back(str.substr(begin, size));
+    });
+}
+
 } // namespace berts::unicode
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <compare>
 #include <cstdint>
 #include <functional>
 #include <ranges>
 #include <string>
+#include <string_view>
 #include <vector>
+#include "berts/models/hash.hpp"
+#include "berts/models/unicode_tables.hpp"
 
 namespace berts::unicode {
 
@@ -18,14 +22,66 @@ bool normalize_nfc(const ustr &in, ustr &out);
 
 bool normalize_nfd(const ustr &in, ustr &out);
 
+/// @brief packed properties of `c` (tables::PROP_*)
+constexpr uint16_t properties(unic32_t c) noexcept {
+    using namespace tables;
+    if (c < 0 || 0x10ffff < c) {
+        return PROP_CONTROL;
+    }
+    const auto block = prop_stage1[c >> block_bits];
+    return prop_stage2[(block << block_bits) | (c & ((1 << block_bits) - 1))];
+}
+
 // '\t' + Zs
-bool is_whitespace(unic32_t c);
+constexpr bool is_whitespace(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_WHITESPACE;
+}
 
 // C*
-bool is_control(unic32_t c);
-
-// P*
-bool is_punct(unic32_t c);
+constexpr bool is_control(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_CONTROL;
+}
+
+// P* + ASCII symbols
+constexpr bool is_punct(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_PUNCT;
+}
+
+// Mn
+constexpr bool is_nonspacing_mark(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_MN;
+}
+
+// CJK ideographs (transformers.BasicTokenizer._is_chinese_char)
+constexpr bool is_cjk(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_CJK;
+}
+
+// L*
+constexpr bool is_letter(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_LETTER;
+}
+
+// N*
+constexpr bool is_number(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_NUMBER;
+}
+
+// NFC_Quick_Check != Yes or ccc != 0
+// a string without such code points is already NFC
+constexpr bool is_nfc_unsafe(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_NFC_UNSAFE;
+}
+
+// NFD_Quick_Check != Yes or ccc != 0
+constexpr bool is_nfd_unsafe(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_NFD_UNSAFE;
+}
+
+// White_Space, i.e. `\s` of ICU regex (unlike is_whitespace, includes line breaks)
+constexpr bool is_space(unic32_t c) noexcept {
+    return properties(c) & tables::PROP_SPACE;
+}
 
 const char *category(unic32_t c);
 
@@ -35,82 +91,201 @@ bool to_lower(const ustr &in, ustr &out);
 
 bool to_upper(const ustr &in, ustr &out);
 
-struct ustr_impl;
+//
+// UTF-8
+//
+
+/// @brief length of the leading ASCII-only bytes of `s` (vectorized with AVX2/SSE2 if available)
+size_t ascii_span(std::string_view s) noexcept;
+
+/// @brief `true` if all bytes are ASCII
+inline bool is_ascii(std::string_view s) noexcept {
+    return ascii_span(s) == s.size();
+}
+
+/// @brief decode one code point at `s[i]` and advance `i`
+/// @return the code point; U+FFFD for an invalid sequence (one byte is consumed)
+inline unic32_t decode_utf8(std::string_view s, size_t &i) noexcept {
+    const auto b0 = (unsigned char)s[i];
+    if (b0 < 0x80) {
+        i += 1;
+        return b0;
+    }
 
-// UTF-16 string buffer
-struct ustr {
-    ustr();
-    ustr(const char *in_utf8);
-    ustr(const char *in_utf8, size_t size);
-    ustr(const unic_t *in_utf16, size_t count);
-    ustr(const unic32_t *in_utf32, size_t count);
-    ustr(const ustr &in);
-    ustr(ustr &&in) noexcept;
+    size_t n;
+    unic32_t c;
+    unic32_t min;
+    if ((b0 & 0xe0) == 0xc0) {
+        n = 2, c = b0 & 0x1f, min = 0x80;
+    } else if ((b0 & 0xf0) == 0xe0) {
+        n = 3, c = b0 & 0x0f, min = 0x800;
+    } else if ((b0 & 0xf8) == 0xf0) {
+        n = 4, c = b0 & 0x07, min = 0x10000;
+    } else {
+        i += 1;
+        return 0xfffd;
+    }
 
-    template <std::ranges::range View>
-    ustr(const View &range)
-        : ustr(range.data(), range.size()) {}
+    if (s.size() - i < n) {
+        i += 1;
+        return 0xfffd;
+    }
 
-    ~ustr();
+    for (size_t k = 1; k < n; ++k) {
+        const auto b = (unsigned char)s[i + k];
+        if ((b & 0xc0) != 0x80) {
+            i += 1;
+            return 0xfffd;
+        }
+        c = (c << 6) | (b & 0x3f);
+    }
 
-    ustr &operator=(const ustr &in);
-    ustr &operator=(ustr &&in) noexcept;
+    // overlong, surrogate or out of range
+    if (c < min || (0xd800 <= c && c < 0xe000) || 0x10ffff < c) {
+        i += 1;
+        return 0xfffd;
+    }
 
-    bool operator==(const ustr &rhs) const;
+    i += n;
+    return c;
+}
+
+/// @brief append UTF-8 bytes of `c` to `out`
+inline void encode_utf8(unic32_t c, std::string &out) {
+    if (c < 0x80) {
+        out += (char)c;
+    } else if (c < 0x800) {
+        out += (char)(0xc0 | (c >> 6));
+        out += (char)(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+        out += (char)(0xe0 | (c >> 12));
+        out += (char)(0x80 | ((c >> 6) & 0x3f));
+        out += (char)(0x80 | (c & 0x3f));
+    } else {
+        out += (char)(0xf0 | (c >> 18));
+        out += (char)(0x80 | ((c >> 12) & 0x3f));
+        out += (char)(0x80 | ((c >> 6) & 0x3f));
+        out += (char)(0x80 | (c & 0x3f));
+    }
+}
 
-    std::strong_ordering operator<=>(const ustr &rhs) const;
+// the following functions overwrite `out` and reuse its capacity;
+// UTF-16 buffers used internally are kept per thread
 
-    ustr operator+(const ustr &rhs) const;
+bool normalize_nfc(std::string_view in, std::string &out);
 
-    ustr &operator+=(const ustr &rhs);
+bool normalize_nfd(std::string_view in, std::string &out);
 
-    bool ok() const;
+/// @brief quick check; `true` if `s` is surely NFC
+/// @note `normalize_nfc` normalizes only the spans which fail the quick check
+bool is_nfc(std::string_view s) noexcept;
 
-    void dispose();
+/// @brief quick check; `true` if `s` is surely NFD
+bool is_nfd(std::string_view s) noexcept;
 
-    bool empty() const;
+/// @brief full case mapping (root locale) like `to_lower(const ustr &, ustr &)`
+bool to_lower(std::string_view in, std::string &out);
 
-    std::string encode() const;
+/// @brief lowercase -> NFD -> remove Mn -> NFC of one code point, without context (root locale)
+/// @return `false` if `c` maps to itself; `folded` may be empty (e.g. combining marks)
+inline bool fold_lower_strip(unic32_t c, std::string_view &folded) noexcept {
+    using namespace tables;
+    if (c < 0 || 0x10ffff < c) {
+        return false;
+    }
+    const auto block = fold_stage1[c >> block_bits];
+    const auto offset = fold_stage2[(block << block_bits) | (c & ((1 << block_bits) - 1))];
+    if (offset == 0) {
+        return false;
+    }
+    folded = {(const char *)&fold_pool[offset + 1], fold_pool[offset]};
+    return true;
+}
 
-    size_t bytesize() const;
+/// @brief `to_lower` + strip accents (NFD -> remove Mn -> NFC) with the fold table
+/// the result is the same as applying each step in order
+bool lower_strip_accents(std::string_view in, std::string &out);
 
-    size_t packsize() const;
+// non-owning view of UTF-16 code units, e.g. a slice of `ustr`
+struct ustr_view {
+    static constexpr size_t npos = (size_t)-1;
 
-    size_t codepoints() const;
+    const unic_t *str = nullptr;
+    size_t len = 0;
 
-    void pack_to(unic_t *buffer) const;
+    constexpr ustr_view() noexcept = default;
 
-    void pack_to(std::vector<unic_t> &buffer) const;
+    constexpr ustr_view(const unic_t *str, size_t len) noexcept
+        : str(str)
+        , len(len) {}
 
-    void pack_to(std::vector<unic32_t> &buffer) const;
+    const unic_t *data() const noexcept {
+        return str;
+    }
 
-    unic_t operator[](size_t index) const;
+    size_t size() const noexcept {
+        return len;
+    }
 
-    //
-    // string operations
-    //
+    size_t packsize() const noexcept {
+        return len;
+    }
 
-    bool starts_with(const ustr &prefix) const;
+    bool empty() const noexcept {
+        return len == 0;
+    }
 
-    bool ends_with(const ustr &suffix) const;
+    const unic_t *begin() const noexcept {
+        return str;
+    }
 
-    ustr lstrip() const;
+    const unic_t *end() const noexcept {
+        return str + len;
+    }
 
-    ustr rstrip() const;
+    unic_t operator[](size_t index) const noexcept {
+        return index < len ? str[index] : (unic_t)0xfffd;
+    }
+
+    /// @brief [pos, pos + n) in code units; clamped to the view
+    ustr_view substr(size_t pos, size_t n = npos) const noexcept {
+        pos = pos < len ? pos : len;
+        n = n < len - pos ? n : len - pos;
+        return {str + pos, n};
+    }
+
+    bool starts_with(ustr_view prefix) const noexcept {
+        return prefix.len <= len && substr(0, prefix.len) == prefix;
+    }
+
+    bool ends_with(ustr_view suffix) const noexcept {
+        return suffix.len <= len && substr(len - suffix.len) == suffix;
+    }
+
+    size_t codepoints() const;
+
+    std::string encode() const;
+
+    /// @brief overwrite `out` with UTF-8 of this view, reusing its capacity
+    /// @return `false` if the view is not a valid UTF-16 (`out` is empty)
+    bool encode_to(std::string &out) const;
+
+    friend bool operator==(ustr_view lhs, ustr_view rhs) noexcept {
+        return lhs.len == rhs.len && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend std::strong_ordering operator<=>(ustr_view lhs, ustr_view rhs) noexcept {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
 
     //
     // iterators
     //
 
-    unic_t *begin() const;
-
-    unic_t *end() const;
-
     template <typename Fn>
     void each(Fn &&fn) const {
-        const size_t n = packsize();
-        for (size_t i = 0; i < n; ++i) {
-            fn((*this)[i]);
+        for (size_t i = 0; i < len; ++i) {
+            fn(str[i]);
         }
     }
 
@@ -175,8 +350,133 @@ struct ustr {
             if (!skip_invalid) fn(cp{0xfffd, surrogate, 0});
         }
     }
+};
+
+// UTF-16 string buffer
+// strings up to `inline_capacity` code units are stored inline without heap allocation
+struct ustr {
+    // sizeof(ustr) == 48
+    static constexpr size_t inline_capacity = 14;
+
+    ustr() noexcept
+        : str_(buf_)
+        , size_(0)
+        , capacity_(inline_capacity)
+        , e_(0) {}
+
+    ustr(const char *in_utf8);
+    ustr(const char *in_utf8, size_t size);
+    ustr(const unic_t *in_utf16, size_t count);
+    ustr(const unic32_t *in_utf32, size_t count);
+    ustr(const ustr &in);
+    ustr(ustr &&in) noexcept;
+
+    template <std::ranges::range View>
+    ustr(const View &range)
+        : ustr(range.data(), range.size()) {}
+
+    ~ustr();
+
+    ustr &operator=(const ustr &in);
+    ustr &operator=(ustr &&in) noexcept;
+
+    bool operator==(ustr_view rhs) const noexcept {
+        return view() == rhs;
+    }
+
+    std::strong_ordering operator<=>(ustr_view rhs) const noexcept {
+        return view() <=> rhs;
+    }
+
+    ustr operator+(ustr_view rhs) const;
+
+    ustr &operator+=(ustr_view rhs);
+
+    operator ustr_view() const noexcept {
+        return view();
+    }
+
+    ustr_view view() const noexcept {
+        return {str_, (size_t)size_};
+    }
+
+    /// @brief [pos, pos + n) in code units without copying
+    ustr_view substr(size_t pos, size_t n = ustr_view::npos) const noexcept {
+        return view().substr(pos, n);
+    }
+
+    bool ok() const;
+
+    /// @brief release the heap buffer and reset the error
+    void dispose();
+
+    /// @brief make empty, keeping the buffer
+    void clear() noexcept {
+        size_ = 0;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    std::string encode() const;
+
+    size_t bytesize() const;
+
+    size_t packsize() const;
 
-    ustr_impl *impl;
+    size_t codepoints() const;
+
+    void pack_to(unic_t *buffer) const;
+
+    void pack_to(std::vector<unic_t> &buffer) const;
+
+    void pack_to(std::vector<unic32_t> &buffer) const;
+
+    unic_t operator[](size_t index) const;
+
+    //
+    // string operations
+    //
+
+    bool starts_with(ustr_view prefix) const;
+
+    bool ends_with(ustr_view suffix) const;
+
+    ustr lstrip() const;
+
+    ustr rstrip() const;
+
+    //
+    // iterators
+    //
+
+    unic_t *begin() const;
+
+    unic_t *end() const;
+
+    template <typename Fn>
+    void each(Fn &&fn) const {
+        view().each(std::forward<Fn>(fn));
+    }
+
+    using cp = ustr_view::cp;
+
+    template <typename Fn>
+    void each_cp(bool skip_invalid, Fn &&fn) const {
+        view().each_cp(skip_invalid, std::forward<Fn>(fn));
+    }
+
+    /// @brief discard the content and make room for `size` code units
+    /// @note the heap buffer is kept and reused if it is large enough
+    void alloc(size_t size);
+
+    // buffer (`buf_` or heap), its size and capacity in code units, and UErrorCode of the last ICU call
+    unic_t *str_;
+    int32_t size_;
+    int32_t capacity_;
+    int32_t e_;
+    unic_t buf_[inline_capacity];
 };
 
 struct regex {
@@ -190,9 +490,13 @@ struct regex {
     regex &operator=(const regex &) = delete;
     regex &operator=(regex &&);
 
-    bool test(const ustr &str);
+    bool test(ustr_view str);
     size_t split(const ustr &str, std::vector<ustr> &out);
 
+    /// @brief split `str` like `split(const ustr &, std::vector<ustr> &)` without copying
+    /// @note the views refer to the buffer of `str`
+    size_t split(ustr_view str, std::vector<ustr_view> &out);
+
     void *impl;
 
     operator bool() const noexcept {
@@ -204,14 +508,17 @@ struct regex {
 
 namespace std {
 
+template <>
+struct hash<berts::unicode::ustr_view> {
+    size_t operator()(berts::unicode::ustr_view s) const {
+        return berts::hash::bytes(s.data(), s.size() * sizeof(berts::unicode::unic_t));
+    }
+};
+
 template <>
 struct hash<berts::unicode::ustr> {
     size_t operator()(const berts::unicode::ustr &s) const {
-        size_t v = 0;
-        for (const auto c : s) {
-            v ^= std::hash<berts::unicode::unic_t>{}(c);
-        }
-        return v;
+        return hash<berts::unicode::ustr_view>{}(s.view());
     }
 };
 
@@ -0,0 +1,119 @@
+#include "berts/models/word_cache.hpp"
+
+#include <mutex>
+
+namespace berts {
+
+word_cache::word_cache(size_t capacity, size_t min_size)
+    : capacity_(capacity)
+    , min_size_(min_size) {}
+
+word_cache::shard &word_cache::shard_of(std::string_view word) const noexcept {
+    // low bits are used by the map
+    const size_t hash = string_hash{}(word);
+    return shards_[(hash >> (sizeof(size_t) * 8 - 8)) % n_shards];
+}
+
+bool word_cache::find(std::string_view word, std::vector<bert_token_t> &out) const {
+    if (!accepts(word)) {
+        return false;
+    }
+
+    const auto &s = shard_of(word);
+
+    {
+        std::shared_lock lock{s.mutex};
+        const auto it = s.map.find(word);
+        if (it != s.map.end()) {
+            const auto &e = s.entries[it->second];
+            out.insert(out.end(), e.ids.begin(), e.ids.end());
+            if (!e.referenced.load(std::memory_order_relaxed)) {
+                e.referenced.store(true, std::memory_order_relaxed);
+            }
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void word_cache::insert(std::string_view word, std::span<const bert_token_t> ids) const {
+    if (!accepts(word)) {
+        return;
+    }
+
+    auto &s = shard_of(word);
+    const size_t shard_capacity = (capacity_ + n_shards - 1) / n_shards;
+
+    std::unique_lock lock{s.mutex};
+
+    if (s.map.contains(word)) {
+        // inserted by another thread
+        return;
+    }
+
+    size_t index;
+    if (s.entries.size() < shard_capacity) {
+        index = s.entries.size();
+        s.entries.emplace_back();
+    } else {
+        // second chance: skip (and unmark) recently used entries
+        while (s.entries[s.hand].referenced.exchange(false, std::memory_order_relaxed)) {
+            s.hand = (s.hand + 1) % s.entries.size();
+        }
+        index = s.hand;
+        s.hand = (s.hand + 1) % s.entries.size();
+        s.map.erase(s.entries[index].word);
+    }
+
+    auto &e = s.entries[index];
+    e.word.assign(word);
+    e.ids.assign(ids.begin(), ids.end());
+    e.referenced.store(false, std::memory_order_relaxed);
+    s.map.emplace(e.word, (uint32_t)index);
+}
+
+void word_cache::clear() {
+    for (auto &s : shards_) {
+        std::unique_lock lock{s.mutex};
+        s.map.clear();
+        s.entries.clear();
+        s.hand = 0;
+    }
+    hits_ = 0;
+    misses_ = 0;
+}
+
+word_cache::stats word_cache::get_stats() const noexcept {
+    size_t entries = 0;
+    for (const auto &s : shards_) {
+        std::shared_lock lock{s.mutex};
+        entries += s.map.size();
+    }
+    return {
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+        entries,
+        capacity_,
+    };
+}
+
+size_t word_cache::memory_size() const noexcept {
+    size_t size = 0;
+    for (const auto &s : shards_) {
+        std::shared_lock lock{s.mutex};
+        // map nodes + entries (word: SSO or heap)
+        size += s.map.bucket_count() * sizeof(void *) +
+                s.map.size() * (sizeof(std::string_view) + sizeof(uint32_t) + 2 * sizeof(void *));
+        for (const auto &e : s.entries) {
+            size += sizeof(e) +
+                    (e.word.capacity() < sizeof(e.word) ? 0 : e.word.capacity()) +
+                    e.ids.capacity() * sizeof(bert_token_t);
+        }
+    }
+    return size;
+}
+
+} // namespace berts
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "berts/berts.h"
+#include "berts/models/hash.hpp"
+
+namespace berts {
+
+/**
+ * bounded word -> token ids cache shared by threads
+ *
+ * words are distributed to shards by hash and each shard has its own lock;
+ * lookups take the lock shared, so readers do not block each other.
+ * when a shard is full, an entry is evicted by CLOCK (second chance):
+ * a hit marks the entry and the hand skips marked entries once,
+ * which approximates LRU without reordering anything on lookups.
+ */
+struct word_cache {
+    static constexpr size_t n_shards = 16;
+
+    // words out of [min_word_size, max_word_size] are not cached;
+    // short words are tokenized faster than a lookup
+    static constexpr size_t min_word_size = 12;
+    static constexpr size_t max_word_size = 64;
+
+    static constexpr size_t default_capacity = 1 << 16;
+
+    /// @param capacity max number of words; 0 disables the cache
+    /// @param min_size words shorter than this are not cached
+    explicit word_cache(size_t capacity = default_capacity, size_t min_size = min_word_size);
+
+    word_cache(const word_cache &) = delete;
+    word_cache &operator=(const word_cache &) = delete;
+
+    /// @brief `true` if `word` may be cached
+    bool accepts(std::string_view word) const noexcept {
+        return capacity_ != 0 && min_size_ <= word.size() && word.size() <= max_word_size;
+    }
+
+    /// @brief append cached ids of `word` to `out`
+    /// @return `false` if `word` is not cached
+    bool find(std::string_view word, std::vector<bert_token_t> &out) const;
+
+    /// @brief cache ids of `word`
+    void insert(std::string_view word, std::span<const bert_token_t> ids) const;
+
+    void clear();
+
+    struct stats {
+        uint64_t hits;
+        uint64_t misses;
+        size_t entries;
+        size_t capacity;
+    };
+
+    stats get_stats() const noexcept;
+
+    /// @brief approximate allocated bytes
+    size_t memory_size() const noexcept;
+
+  private:
+    struct string_hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const noexcept {
+            return hash::string(s);
+        }
+    };
+
+    struct entry {
+        std::string word;
+        std::vector<bert_token_t> ids;
+        // set on hit, cleared by the clock hand
+        mutable std::atomic_bool referenced{false};
+    };
+
+    struct shard {
+        mutable std::shared_mutex mutex;
+        // word (a view of entries[i].word) -> i
+        std::unordered_map<std::string_view, uint32_t, string_hash> map;
+        // references are kept while growing; slots are reused after eviction
+        std::deque<entry> entries;
+        size_t hand = 0;
+    };
+
+    size_t capacity_;
+    size_t min_size_;
+    mutable std::array<shard, n_shards> shards_;
+    mutable std::atomic_uint64_t hits_{0};
+    mutable std::atomic_uint64_t misses_{0};
+
+    shard &shard_of(std::string_view word) const noexcept;
+};
+
+} // namespace berts
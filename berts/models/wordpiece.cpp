@@ -0,0 +1,187 @@
+#include "berts/models/wordpiece.hpp"
+
+#include <deque>
+
+namespace berts::wordpiece {
+
+bool wordpiece::build(const trie::trie *trie, std::string_view suffix_indicator) {
+    clear();
+
+    if (!trie || suffix_indicator.empty()) {
+        return false;
+    }
+
+    const auto root = trie::trie_root(trie);
+    const auto suffix_root = trie::search_node(root, suffix_indicator);
+    if (!suffix_root) {
+        return false;
+    }
+
+    const size_t n_units = trie::trie_unit_count(trie);
+    std::vector<link> links(n_units, link{-1, 0, 0});
+    std::vector<bert_token_t> pops;
+
+    auto index = [trie](const trie::trie_node *n) {
+        return trie::trie_node_index(trie, n);
+    };
+
+    // f(v) and F(v) are fixed before any child of v is visited (BFS)
+    std::deque<const trie::trie_node *> queue{root};
+    while (!queue.empty()) {
+        const auto v = queue.front();
+        queue.pop_front();
+        const auto &lv = links[index(v)];
+
+        for (int b = 0; b < 256; ++b) {
+            const char c = (char)b;
+            const auto u = trie::trie_next(v, c);
+            if (!u) {
+                continue;
+            }
+            queue.push_back(u);
+
+            if (u == suffix_root) {
+                // f(r##) = null, F(r##) = []
+                continue;
+            }
+
+            auto &lu = links[index(u)];
+            lu.pops_begin = (uint32_t)pops.size();
+
+            if (const auto id = trie::trie_node_id(u); id != BERTS_INVALID_TOKEN_ID) {
+                // str(u) is a token: emit it and continue as a suffix
+                pops.push_back(id);
+                lu.fail = (int32_t)index(suffix_root);
+                lu.pops_end = (uint32_t)pops.size();
+                continue;
+            }
+
+            // F(u) = F(v) + F(z1) + F(z2) + ... until δ(z, c) is found
+            int32_t z = lv.fail;
+            for (uint32_t i = lv.pops_begin; i < lv.pops_end; ++i) {
+                const auto id = pops[i];
+                pops.push_back(id);
+            }
+            while (z >= 0 && !trie::trie_next(root + z, c)) {
+                const auto &lz = links[z];
+                for (uint32_t i = lz.pops_begin; i < lz.pops_end; ++i) {
+                    const auto id = pops[i];
+                    pops.push_back(id);
+                }
+                z = lz.fail;
+            }
+
+            if (z >= 0) {
+                lu.fail = (int32_t)index(trie::trie_next(root + z, c));
+                lu.pops_end = (uint32_t)pops.size();
+            } else {
+                // no way to tokenize
+                pops.resize(lu.pops_begin);
+                lu.pops_end = lu.pops_begin;
+            }
+        }
+    }
+
+    pops.shrink_to_fit();
+
+    trie_ = trie;
+    root_ = root;
+    suffix_root_ = suffix_root;
+    suffix_indicator_ = suffix_indicator;
+    links_ = std::move(links);
+    pops_ = std::move(pops);
+
+    return true;
+}
+
+void wordpiece::clear() {
+    trie_ = nullptr;
+    root_ = nullptr;
+    suffix_root_ = nullptr;
+    suffix_indicator_.clear();
+    links_.clear();
+    links_.shrink_to_fit();
+    pops_.clear();
+    pops_.shrink_to_fit();
+}
+
+bool wordpiece::tokenize(std::string_view word, bert_token_t unk, std::vector<bert_token_t> &out) const {
+    if (word.empty() || !trie_) {
+        return true;
+    }
+
+    if (word.starts_with(suffix_indicator_)) {
+        // matching from the root passes through r##, whose failure link is only valid for suffixes
+        if (!tokenize_greedy(word, out)) {
+            out.push_back(unk);
+            return false;
+        }
+        return true;
+    }
+
+    const size_t n0 = out.size();
+    const trie::trie_node *u = root_;
+
+    for (const char c : word) {
+        const trie::trie_node *next;
+        while (!(next = trie::trie_next(u, c))) {
+            const auto &l = links_[u - root_];
+            if (l.fail < 0) {
+                goto UNK;
+            }
+            out.insert(out.end(), pops_.begin() + l.pops_begin, pops_.begin() + l.pops_end);
+            u = root_ + l.fail;
+        }
+        u = next;
+    }
+
+    // flush pending tokens
+    while (u != suffix_root_) {
+        const auto &l = links_[u - root_];
+        if (l.fail < 0) {
+            goto UNK;
+        }
+        out.insert(out.end(), pops_.begin() + l.pops_begin, pops_.begin() + l.pops_end);
+        u = root_ + l.fail;
+    }
+
+    return true;
+
+UNK:
+    out.resize(n0);
+    out.push_back(unk);
+    return false;
+}
+
+bool wordpiece::tokenize_greedy(std::string_view word, std::vector<bert_token_t> &out) const {
+    const size_t n0 = out.size();
+    const trie::trie_node *node = root_;
+
+    while (!word.empty()) {
+        size_t len = 0;
+        const auto id = trie::search_trie_substr(node, word, len);
+        if (id == BERTS_INVALID_TOKEN_ID) {
+            out.resize(n0);
+            return false;
+        }
+        out.push_back(id);
+        word.remove_prefix(len);
+        node = suffix_root_;
+    }
+
+    return true;
+}
+
+size_t wordpiece::memory_size() const noexcept {
+    return links_.capacity() * sizeof(link) +
+           pops_.capacity() * sizeof(bert_token_t) +
+           suffix_indicator_.capacity();
+}
+
+size_t wordpiece::estimate_memory_size(size_t n_bytes) noexcept {
+    // pops of a node are bounded by its depth in practice
+    return trie::estimate_trie_unit_count(n_bytes) * sizeof(link) +
+           n_bytes * 2 * sizeof(bert_token_t);
+}
+
+} // namespace berts::wordpiece
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "berts/berts.h"
+#include "berts/models/trie.hpp"
+
+namespace berts::wordpiece {
+
+/**
+ * single-pass WordPiece tokenizer (LinMaxMatch)
+ *
+ * ---
+ * ref: Song et al., Fast WordPiece Tokenization (EMNLP 2021)
+ *
+ * each node of the vocab trie has a failure link and failure pops:
+ * when the next byte has no transition, tokens in the pops are emitted
+ * and matching continues from the failure link without going back in the word.
+ * the result is the same as the greedy longest-match-first algorithm,
+ * and the whole word becomes [UNK] when it can not be tokenized.
+ */
+struct wordpiece {
+    wordpiece() = default;
+
+    /// @brief precompute failure links over `trie`; `trie` must outlive this instance
+    /// @param suffix_indicator prefix of continuing subwords
+    /// @return `false` if `suffix_indicator` is not found in the trie
+    bool build(const trie::trie *trie, std::string_view suffix_indicator = "##");
+
+    void clear();
+
+    bool empty() const noexcept {
+        return trie_ == nullptr;
+    }
+
+    /// @brief tokenize one word and append token ids to `out`
+    /// @return `false` if the word can not be tokenized; `unk` is appended instead
+    bool tokenize(std::string_view word, bert_token_t unk, std::vector<bert_token_t> &out) const;
+
+    /// @brief approximate allocated bytes (excluding the trie)
+    size_t memory_size() const noexcept;
+
+    /// @brief approximate upper bound of bytes for tokens with `n_bytes` bytes (UTF-8) in total
+    static size_t estimate_memory_size(size_t n_bytes) noexcept;
+
+  private:
+    struct link {
+        int32_t fail;        // unit index of failure link; -1 if none
+        uint32_t pops_begin; // [pops_begin, pops_end) of pops_
+        uint32_t pops_end;
+    };
+
+    const trie::trie *trie_ = nullptr;
+    const trie::trie_node *root_ = nullptr;
+    const trie::trie_node *suffix_root_ = nullptr;
+    std::string suffix_indicator_;
+    std::vector<link> links_;
+    std::vector<bert_token_t> pops_;
+
+    // greedy longest-match-first, for words which start with the suffix indicator
+    bool tokenize_greedy(std::string_view word, std::vector<bert_token_t> &out) const;
+};
+
+} // namespace berts::wordpiece
@@ -0,0 +1,59 @@
+#pragma once
+
+/**
+ * counts heap allocations made through the global operator new
+ * include this from exactly one translation unit of a test
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace berts::tests {
+
+inline std::atomic<size_t> n_allocs{0};
+
+/// @brief number of calls to the global operator new so far
+inline size_t alloc_count() {
+    return n_allocs.load(std::memory_order_relaxed);
+}
+
+} // namespace berts::tests
+
+// the replaced operator new allocates with malloc, so freeing with free is correct
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *operator new(std::size_t size) {
+    berts::tests::n_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void *operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
@@ -68,6 +68,56 @@ int main() {
         fclose(fp);
     }
 
+    // eval timings
+    {
+        berts_eval_timings timings{};
+        berts_eval_info cond{};
+        berts_init_eval_info(&cond);
+        assert(cond.timings == nullptr);
+        cond.timings = &timings;
+
+        size_t out_size = 0;
+        auto result = berts_eval(ctx, tokens.get(), nullptr, size, &cond, nullptr, &out_size);
+        assert(result);
+        assert(timings.graph_size == 0); // not written by dry run
+
+        std::unique_ptr<float[]> out{new float[out_size]};
+        result = berts_eval(ctx, tokens.get(), nullptr, size, &cond, out.get(), &out_size);
+        assert(result);
+        assert(timings.compute_us > 0);
+        assert(timings.graph_us >= 0 && timings.plan_us >= 0 && timings.output_us >= 0);
+        assert(timings.graph_size);
+    }
+
+    // memory accounting
+    {
+        berts_memory_stats stats{};
+        bool ok = berts_memory_usage(ctx, &stats);
+        assert(ok);
+        assert(stats.weights);
+        assert(stats.vocab);
+        assert(stats.scratch);
+        assert(stats.scratch_peak);
+        assert(stats.scratch_peak <= stats.scratch + stats.plan);
+
+        berts_memory_stats est{};
+        ok = berts_estimate_memory(model_path, size, 1, nullptr, &est);
+        assert(ok);
+        assert(est.weights == stats.weights);
+        assert(est.vocab);
+        assert(est.scratch_peak >= stats.scratch_peak);
+
+        // bytes backed by huge pages never exceed the mapped (2 MiB rounded) size
+        berts_huge_pages_info info{};
+        ok = berts_get_huge_pages_info(ctx, &info);
+        assert(ok);
+        assert(info.weights_size);
+        assert(info.weights_huge <= info.weights_size + 2 * 1024 * 1024);
+        assert(info.scratch_size);
+        assert(info.scratch_huge <= info.scratch_size + 2 * 2 * 1024 * 1024);
+        assert(!berts_get_huge_pages_info(nullptr, &info));
+    }
+
     berts_free(ctx);
 
     return 0;
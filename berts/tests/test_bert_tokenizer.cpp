@@ -1,10 +1,13 @@
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 #include "berts/berts.h"
 #include "berts/models/fmt.hpp"
 
 #define BERTS_TEST_SHORTHAND
+#include "berts/tests/alloc_counter.hpp"
 #include "berts/tests/tests.hpp"
 
 test_def {
@@ -145,6 +148,182 @@ test_def {
             assert(tokens[11] == 136);  // ?
             assert(tokens[12] == 102);  // [SEP]
         };
+
+        testcase(tokenize_special_in_word) {
+            // special tokens are split even if they are not separated by spaces
+            const std::string text1 = berts::fmt::fmt("Hi, I am[MASK].");
+            size_t size = text1.size();
+            std::unique_ptr<bert_token_t[]> tokens{new bert_token_t[size]};
+            bool ok = berts_tokenize(ctx, text1.c_str(), tokens.get(), &size);
+            assert(ok);
+            assert(size == 8);
+            assert(tokens[0] == 101);  // [CLS]
+            assert(tokens[1] == 8790); // Hi
+            assert(tokens[2] == 117);  // ,
+            assert(tokens[3] == 146);  // I
+            assert(tokens[4] == 1821); // am
+            assert(tokens[5] == 103);  // [MASK]
+            assert(tokens[6] == 119);  // .
+            assert(tokens[7] == 102);  // [SEP]
+        };
+
+        testcase(tokenize_into) {
+            const std::string text1 = "Hi, I am [MASK] man.";
+            std::array<bert_token_t, 16> tokens{};
+            std::array<berts_token_span, 16> spans{};
+            size_t size = tokens.size();
+            bool ok = berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), spans.data(), &size);
+            assert(ok);
+            assert(size == 9);
+
+            const std::array<berts_token_span, 9> expected{{
+                {0, 0},   // [CLS]
+                {0, 2},   // Hi
+                {2, 3},   // ,
+                {4, 5},   // I
+                {6, 8},   // am
+                {9, 15},  // [MASK]
+                {16, 19}, // man
+                {19, 20}, // .
+                {20, 20}, // [SEP]
+            }};
+            for (size_t i = 0; i < size; ++i) {
+                assert(spans[i].begin == expected[i].begin);
+                assert(spans[i].end == expected[i].end);
+            }
+
+            // same as berts_tokenize
+            size_t size1 = text1.size() + 2;
+            std::vector<bert_token_t> tokens1(size1);
+            assert(berts_tokenize(ctx, text1.c_str(), tokens1.data(), &size1));
+            assert(size1 == size);
+            assert(std::equal(tokens1.begin(), tokens1.begin() + size1, tokens.begin()));
+        };
+
+        testcase(tokenize_into_no_alloc) {
+            // once the per-thread buffers and the word cache are warmed up, no heap memory is allocated
+            const auto level = berts_get_log_level();
+            berts_set_log_level(BERTS_LOG_WARN);
+
+            const std::string text1 = "Hi, I am [MASK] man. How are you?";
+            std::array<bert_token_t, 32> tokens{};
+            std::array<berts_token_span, 32> spans{};
+            size_t size = tokens.size();
+            assert(berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), spans.data(), &size));
+
+            const size_t n0 = berts::tests::alloc_count();
+            for (size_t i = 0; i < 100; ++i) {
+                size = tokens.size();
+                assert(berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), spans.data(), &size));
+                size = tokens.size();
+                assert(berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), nullptr, &size));
+            }
+            const size_t n1 = berts::tests::alloc_count();
+
+            berts_set_log_level(level);
+
+            assert(size == 13);
+            assert(n0 == n1);
+        };
+
+        testcase(tokenize_batch) {
+            std::vector<std::string> texts;
+            for (size_t i = 0; i < 100; ++i) {
+                texts.push_back(berts::fmt::fmt("Hi, I am [MASK] man No.{}. How are you?", i));
+            }
+            texts.push_back("");
+            std::vector<const char *> ptrs;
+            for (const auto &text : texts) {
+                ptrs.push_back(text.c_str());
+            }
+            const size_t n = ptrs.size();
+
+            berts_tokenize_batch_info cond{};
+            berts_init_tokenize_batch_info(&cond);
+            cond.n_threads = 4;
+
+            size_t total = 0;
+            bool ok = berts_tokenize_batch(ctx, ptrs.data(), n, &cond, nullptr, &total, nullptr, nullptr);
+            assert(ok);
+
+            std::vector<bert_token_t> ids(total);
+            std::vector<size_t> offsets(n + 1);
+            berts_padded_batch padded{};
+            ok = berts_tokenize_batch(ctx, ptrs.data(), n, &cond, ids.data(), &total, offsets.data(), &padded);
+            assert(ok);
+            assert(offsets[n] == total);
+
+            // too small out is rejected and the needed length is written
+            size_t small = total - 1;
+            assert(!berts_tokenize_batch(ctx, ptrs.data(), n, &cond, ids.data(), &small, nullptr, nullptr));
+            assert(small == total);
+
+            // out without out_len is rejected
+            assert(!berts_tokenize_batch(ctx, ptrs.data(), n, &cond, ids.data(), nullptr, nullptr, nullptr));
+
+            // same as berts_tokenize
+            size_t longest = 0;
+            for (size_t i = 0; i < n; ++i) {
+                size_t size = texts[i].size() + 2;
+                std::vector<bert_token_t> tokens(size);
+                assert(berts_tokenize(ctx, ptrs[i], tokens.data(), &size));
+                tokens.resize(size);
+                assert(std::equal(tokens.begin(), tokens.end(), ids.begin() + offsets[i], ids.begin() + offsets[i + 1]));
+                longest = std::max(longest, size);
+            }
+            assert(padded.max_len == longest);
+
+            // truncated and padded
+            const size_t len = 8;
+            std::vector<bert_token_t> padded_ids(n * len);
+            std::vector<bert_segment_t> padded_segments(n * len, 1);
+            std::vector<uint8_t> padded_mask(n * len);
+            padded = {len, padded_ids.data(), padded_segments.data(), padded_mask.data()};
+            ok = berts_tokenize_batch(ctx, ptrs.data(), n, nullptr, nullptr, nullptr, nullptr, &padded);
+            assert(ok);
+            assert(padded_ids[0] == 101);       // [CLS]
+            assert(padded_ids[len - 1] == 102); // [SEP]
+            assert(padded_mask[len - 1] == 1);
+            assert(padded_ids[(n - 1) * len + 0] == 101);
+            assert(padded_ids[(n - 1) * len + 1] == 102);
+            assert(padded_ids[(n - 1) * len + 2] == berts_pad_id(ctx));
+            assert(padded_mask[(n - 1) * len + 1] == 1);
+            assert(padded_mask[(n - 1) * len + 2] == 0);
+            assert(std::all_of(padded_segments.begin(), padded_segments.end(), [](bert_segment_t s) { return s == 0; }));
+
+            // no room for [CLS] and [SEP]
+            padded = {1, padded_ids.data(), nullptr, nullptr};
+            assert(!berts_tokenize_batch(ctx, ptrs.data(), n, nullptr, nullptr, nullptr, nullptr, &padded));
+        };
+
+        testcase(tokenize_long_text) {
+            // a long text is split into chunks and tokenized in parallel if requested
+            std::string text;
+            for (size_t i = 0; text.size() < 1'000'000; ++i) {
+                text += berts::fmt::fmt("Hi, I am [MASK] man No.{}.{}", i, i % 7 == 0 ? "\n" : "  ");
+            }
+
+            berts_tokenize_info cond{};
+            berts_init_tokenize_info(&cond);
+            assert(cond.n_threads == 1); // opt-in
+            cond.n_threads = 4;
+
+            size_t size = text.size() + 2;
+            std::vector<bert_token_t> tokens(size);
+            bool ok = berts_tokenize_into(ctx, text.data(), text.size(), &cond, tokens.data(), nullptr, &size);
+            assert(ok);
+            tokens.resize(size);
+
+            // each text of a batch is tokenized on one thread
+            const char *texts[] = {text.c_str()};
+            size_t size1 = text.size() + 2;
+            std::vector<bert_token_t> tokens1(size1);
+            ok = berts_tokenize_batch(ctx, texts, 1, nullptr, tokens1.data(), &size1, nullptr, nullptr);
+            assert(ok);
+            tokens1.resize(size1);
+
+            assert(tokens == tokens1);
+        };
     };
 };
 
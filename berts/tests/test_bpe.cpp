@@ -1,4 +1,7 @@
+#include <chrono>
+#include <cstdio>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "berts/berts.h"
 #include "berts/models/bpe.hpp"
@@ -228,6 +231,159 @@ test_def {
         };
     };
 
+    // symbol ids -> token ids
+    test(bpe_tokenize_ids) {
+        berts::bpe bpe{"<unk>", 0.0, true};
+        vocab_t vocab{{
+            {str_t{"<unk>"}, 0},
+            {str_t{"u"}, 1},
+            {str_t{"n"}, 2},
+            {str_t{"r"}, 3},
+            {str_t{"e"}, 4},
+            {str_t{"l"}, 5},
+            {str_t{"a"}, 6},
+            {str_t{"t"}, 7},
+            {str_t{"d"}, 8},
+            {str_t{"re"}, 9},
+            {str_t{"at"}, 10},
+            {str_t{"ed"}, 11},
+            {str_t{"un"}, 12},
+            {str_t{"ated"}, 13},
+            {str_t{"rel"}, 14},
+            {str_t{"related"}, 15},
+        }};
+        merge_t merge{{
+            {"r", "e"},
+            {"a", "t"},
+            {"e", "d"},
+            {"u", "n"},
+            {"at", "ed"},
+            {"re", "l"},
+            {"rel", "ated"},
+        }};
+        bool ok = bpe.load_vocab(vocab, merge);
+
+        testcase(load) {
+            assert(ok);
+        };
+
+        testcase(merge) {
+            // "unrelated"
+            std::vector<bert_token_t> out{99};
+            assert(bpe.tokenize(std::vector<bert_token_t>{1, 2, 3, 4, 5, 6, 7, 4, 8}, out));
+            assert(out == std::vector<bert_token_t>({99, 12, 15}));
+        };
+
+        testcase(same_as_string) {
+            for (const char *word : {"unrelated", "related", "dated", "eat", "nu", "tatat"}) {
+                TOKENIZE(r, bpe, word);
+                std::vector<bert_token_t> expected{};
+                for (const auto &token : r) {
+                    bert_token_t id;
+                    assert(bpe.token_to_id(token, id));
+                    expected.push_back(id);
+                }
+
+                std::vector<bert_token_t> symbols{};
+                for (const char *c = word; *c; ++c) {
+                    bert_token_t id;
+                    assert(bpe.token_to_id(str_t{std::string{*c}}, id));
+                    symbols.push_back(id);
+                }
+                std::vector<bert_token_t> out{};
+                assert(bpe.tokenize(symbols, out));
+                assert(out == expected);
+            }
+        };
+
+        testcase(unk) {
+            // unknown symbols are fused into one <unk>
+            const auto x = BERTS_INVALID_TOKEN_ID;
+            std::vector<bert_token_t> out{};
+            assert(bpe.tokenize(std::vector<bert_token_t>{6, x, x, 7}, out));
+            assert(out == std::vector<bert_token_t>({6, 0, 7}));
+        };
+    };
+
+    test(bpe_hash) {
+        testcase(pair) {
+            using hasher = std::hash<berts::bpe::token_id_pair>;
+            assert(hasher{}({1, 2}) != hasher{}({2, 1}));
+            assert(hasher{}({1, 1}) != hasher{}({2, 2}));
+        };
+
+        testcase(ustr) {
+            using hasher = std::hash<str_t>;
+            assert(hasher{}(str_t{"ab"}) != hasher{}(str_t{"ba"}));
+            assert(hasher{}(str_t{"aab"}) != hasher{}(str_t{"b"}));
+            assert(hasher{}(str_t{"ab"}) == hasher{}(str_t{"ab"}));
+        };
+
+        testcase(merge_map) {
+            berts::merge_map m{};
+            assert(m.find(1, 2) == nullptr);
+            m.insert_or_assign(1, 2, {0, 10});
+            m.insert_or_assign(2, 1, {1, 11});
+            m.insert_or_assign(1, 2, {2, 12});
+            assert(m.size() == 2);
+            assert(m.find(1, 2) && m.find(1, 2)->rank == 2 && m.find(1, 2)->new_id == 12);
+            assert(m.find(2, 1) && m.find(2, 1)->new_id == 11);
+            assert(m.find(2, 2) == nullptr);
+
+            for (bert_token_t i = 0; i < 10000; ++i) {
+                m.insert_or_assign(i, i + 1, {i, i * 2});
+            }
+            for (bert_token_t i = 3; i < 10000; ++i) {
+                const auto v = m.find(i, i + 1);
+                assert(v && v->rank == i && v->new_id == i * 2);
+            }
+        };
+    };
+
+    // lookups of the merge table, which are done on every BPE step
+    test(bpe_lookup_bench) {
+        testcase(merge_map) {
+            const bert_token_t n = 50000;
+            const size_t n_lookups = 2000000;
+
+            berts::merge_map flat{};
+            std::unordered_map<berts::bpe::token_id_pair, std::pair<uint32_t, bert_token_t>> node{};
+            flat.reserve(n);
+            node.reserve(n);
+            berts::tests::xorshift32 next{};
+            std::vector<berts::bpe::token_id_pair> keys{};
+            for (bert_token_t i = 0; i < n; ++i) {
+                const bert_token_t a = next() % n, b = next() % n;
+                keys.emplace_back(a, b);
+                flat.insert_or_assign(a, b, {i, i});
+                node.insert_or_assign({a, b}, std::pair{i, i});
+            }
+
+            // half of lookups miss, like probes of adjacent symbols
+            auto bench = [&](const char *name, auto &&find) {
+                const auto t0 = std::chrono::steady_clock::now();
+                size_t found = 0;
+                for (size_t i = 0; i < n_lookups; ++i) {
+                    const auto [a, b] = keys[i % keys.size()];
+                    found += find(a, i % 2 == 0 ? b : b + n);
+                }
+                const auto t1 = std::chrono::steady_clock::now();
+                const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / n_lookups;
+                std::printf("  %-14s %6.1f ns/lookup\n", name, ns);
+                return found;
+            };
+
+            const auto found_flat = bench("merge_map", [&flat](bert_token_t a, bert_token_t b) {
+                return flat.find(a, b) != nullptr;
+            });
+            const auto found_node = bench("unordered_map", [&node](bert_token_t a, bert_token_t b) {
+                return node.find({a, b}) != node.end();
+            });
+            assert(found_flat == found_node);
+            assert(found_flat == n_lookups / 2);
+        };
+    };
+
     // out of vocabulary in merges
     test(bpe_out_of_vocab) {
         berts::bpe bpe{"<unk>", 0.0, false};
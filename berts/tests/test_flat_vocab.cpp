@@ -0,0 +1,142 @@
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "berts/models/flat_vocab.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+using namespace berts;
+
+// deterministic pseudo-random tokens (words, "##" pieces and some multibyte characters), may contain duplicates
+static std::vector<std::string> make_tokens(size_t n, uint32_t n_chars) {
+    static const char *const multibyte[] = {"\xc3\xa9", "\xe3\x81\x82", "\xf0\x9f\x98\x80"};
+    berts::tests::xorshift32 next{};
+    std::vector<std::string> tokens;
+    tokens.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::string token = next() % 3 == 0 ? "##" : "";
+        const size_t len = 1 + next() % 6;
+        for (size_t j = 0; j < len; ++j) {
+            const auto r = next() % (n_chars + 1);
+            if (r == n_chars) {
+                token += multibyte[next() % std::size(multibyte)];
+            } else {
+                token += (char)('a' + r);
+            }
+        }
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+// check `find` and `at` of all tokens against the reference
+static bool matches(const flat_vocab &vocab, const std::unordered_map<std::string, bert_token_t> &ref) {
+    for (const auto &[token, id] : ref) {
+        if (vocab.find(token) != id || vocab.at(id) != token) {
+            return false;
+        }
+    }
+    return true;
+}
+
+test_def {
+    test(flat_vocab) {
+        testcase(empty) {
+            flat_vocab vocab{};
+            assert(vocab.empty());
+            assert(vocab.size() == 0);
+            assert(vocab.find("a") == BERTS_INVALID_TOKEN_ID);
+            assert(vocab.find("") == BERTS_INVALID_TOKEN_ID);
+            assert(vocab.at(0) == "");
+        };
+
+        testcase(add) {
+            // no reserve; the table is rehashed many times
+            const auto tokens = make_tokens(20000, 26);
+            flat_vocab vocab{};
+            std::unordered_map<std::string, bert_token_t> ref{};
+            for (const auto &token : tokens) {
+                const bool added = vocab.add(token);
+                assert(added == !ref.contains(token));
+                if (added) {
+                    ref.emplace(token, (bert_token_t)ref.size());
+                }
+            }
+            assert(vocab.size() == ref.size());
+            assert(matches(vocab, ref));
+
+            // misses
+            for (const auto &token : make_tokens(20000, 27)) {
+                const auto it = ref.find(token);
+                const auto expected = it == ref.end() ? BERTS_INVALID_TOKEN_ID : it->second;
+                assert(vocab.find(token) == expected);
+                assert(vocab.contains(token) == (it != ref.end()));
+            }
+
+            // out of range
+            assert(vocab.at((bert_token_t)vocab.size()) == "");
+            assert(vocab.at(BERTS_INVALID_TOKEN_ID) == "");
+        };
+
+        testcase(insert_with_holes) {
+            const auto tokens = make_tokens(5000, 8);
+            berts::tests::xorshift32 next{};
+            flat_vocab vocab{};
+            vocab.reserve(16);
+            std::unordered_map<std::string, bert_token_t> ref{};
+            std::vector<bert_token_t> holes{};
+            bert_token_t id = 0;
+            for (const auto &token : tokens) {
+                const auto skip = next() % 4 == 0 ? next() % 3 : 0;
+                for (uint32_t k = 0; k < skip; ++k) {
+                    holes.push_back(id + k);
+                }
+                id += skip;
+
+                const bool inserted = vocab.insert(id, token);
+                assert(inserted == !ref.contains(token));
+                if (inserted) {
+                    ref.emplace(token, id);
+                    id += 1;
+                    assert(vocab.size() == id);
+                } else {
+                    // ids skipped for a rejected token are not holes yet
+                    holes.resize(holes.size() - skip);
+                    id -= skip;
+                }
+            }
+            assert(matches(vocab, ref));
+            assert(!holes.empty());
+            for (const auto hole : holes) {
+                assert(vocab.at(hole) == "");
+            }
+
+            // used ids and existing tokens are rejected
+            assert(!vocab.insert(0, "unused"));
+            assert(!vocab.insert(id - 1, "unused"));
+            assert(!vocab.insert(id, tokens[0]));
+            assert(!vocab.insert(BERTS_INVALID_TOKEN_ID, "unused"));
+            assert(vocab.size() == id);
+            assert(vocab.insert(id, "unused"));
+            assert(vocab.find("unused") == id);
+        };
+
+        testcase(clear) {
+            flat_vocab vocab{};
+            assert(vocab.add("hello"));
+            assert(vocab.add("world"));
+            assert(0 < vocab.memory_size());
+            vocab.clear();
+            assert(vocab.empty());
+            assert(vocab.find("hello") == BERTS_INVALID_TOKEN_ID);
+            assert(vocab.add("world"));
+            assert(vocab.find("world") == 0);
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "berts/berts.h"
+#include "berts/models/fmt.hpp"
+#include "berts/models/log.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+struct log_result {
+    std::unordered_set<std::string> messages;
+    size_t lines = 0;
+    size_t dropped = 0;
+};
+
+// messages and reported drops written to `fp`
+static log_result read_log(FILE *fp) {
+    log_result result{};
+    std::rewind(fp);
+    char buf[256];
+    while (std::fgets(buf, sizeof(buf), fp)) {
+        std::string line{buf};
+        if (!line.empty() && line.back() == '\n') line.pop_back();
+        size_t k;
+        if (std::sscanf(line.c_str(), "[berts] %zu log messages were dropped", &k) == 1) {
+            result.dropped += k;
+        } else {
+            result.messages.insert(line);
+            result.lines += 1;
+        }
+    }
+    return result;
+}
+
+// log `n` messages on each of `n_threads` threads
+static void log_from_threads(size_t n_threads, size_t n, std::atomic_bool *done = nullptr) {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < n_threads; ++t) {
+        threads.emplace_back([t, n]() {
+            for (size_t i = 0; i < n; ++i) {
+                berts::log::warn(berts::fmt::fmt("msg {} {}", t, i));
+            }
+        });
+    }
+    for (auto &th : threads) {
+        th.join();
+    }
+    if (done) *done = true;
+}
+
+test_def {
+    test(log) {
+        testcase(sync) {
+            FILE *fp = std::tmpfile();
+            assert(fp);
+            berts_set_log_file(fp);
+            berts_set_log_async(false);
+
+            log_from_threads(4, 1000);
+            berts_flush_log();
+            berts_set_log_file(stderr);
+
+            const auto result = read_log(fp);
+            std::fclose(fp);
+            assert(result.lines == 4000);
+            assert(result.messages.size() == 4000);
+            assert(result.dropped == 0);
+        };
+
+        testcase(async) {
+            FILE *fp = std::tmpfile();
+            assert(fp);
+            berts_set_log_file(fp);
+            berts_set_log_async(true);
+
+            // more messages than the queue can hold; each is either written or counted as dropped
+            const size_t n_threads = 8;
+            const size_t n = 4000;
+            log_from_threads(n_threads, n);
+            berts_flush_log();
+
+            auto result = read_log(fp);
+            assert(result.lines == result.messages.size());
+            assert(result.lines + result.dropped == n_threads * n);
+
+            // messages after flush are not lost either
+            std::fseek(fp, 0, SEEK_END); // switch the stream back to writing
+            berts::log::warn("last");
+            berts_flush_log();
+            result = read_log(fp);
+            assert(result.messages.contains("last"));
+
+            berts_set_log_async(false);
+            berts_set_log_file(stderr);
+            std::fclose(fp);
+        };
+
+        testcase(toggle_async) {
+            FILE *fp = std::tmpfile();
+            assert(fp);
+            berts_set_log_file(fp);
+
+            // switching modes while logging loses nothing
+            const size_t n_threads = 4;
+            const size_t n = 20000;
+            std::atomic_bool done{false};
+            std::thread producer{[&done]() { log_from_threads(n_threads, n, &done); }};
+            for (bool async = true; !done; async = !async) {
+                berts_set_log_async(async);
+                std::this_thread::yield();
+            }
+            producer.join();
+
+            berts_flush_log();
+            berts_set_log_async(false);
+            berts_set_log_file(stderr);
+
+            const auto result = read_log(fp);
+            std::fclose(fp);
+            assert(result.lines == result.messages.size());
+            assert(result.lines + result.dropped == n_threads * n);
+        };
+    };
+}
+
+int main() {
+    berts_set_log_level(BERTS_LOG_WARN);
+    run_tests();
+    return 0;
+}
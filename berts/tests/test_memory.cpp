@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "berts/models/memory.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+using namespace berts::memory;
+
+static bool is_aligned(const void *p, size_t align) {
+    return (uintptr_t)p % align == 0;
+}
+
+static bool all_zero(const page_buffer &buf) {
+    const auto p = static_cast<const unsigned char *>(buf.data());
+    return std::all_of(p, p + buf.size(), [](unsigned char c) { return c == 0; });
+}
+
+// temporary file removed at the end of the scope
+struct temp_file {
+    std::string path;
+
+    temp_file(const std::string &name, const std::vector<char> &content)
+        : path((std::filesystem::temp_directory_path() / name).string()) {
+        std::ofstream out{path, std::ios::binary};
+        out.write(content.data(), (std::streamsize)content.size());
+    }
+
+    ~temp_file() {
+        std::error_code err;
+        std::filesystem::remove(path, err);
+    }
+};
+
+static std::vector<char> make_content(size_t size) {
+    std::vector<char> content(size);
+    berts::tests::xorshift32 next{};
+    for (auto &c : content) {
+        c = (char)next();
+    }
+    return content;
+}
+
+test_def {
+    test(page_buffer) {
+        testcase(alloc) {
+            page_buffer buf{};
+            assert(!buf);
+            assert(!buf.alloc(0, false));
+
+            // normal pages (or heap)
+            assert(buf.alloc(12345, false));
+            assert((bool)buf);
+            assert(buf.size() == 12345);
+            assert(!buf.huge_pages());
+            assert(!buf.is_file_mapping());
+            assert(is_aligned(buf.data(), 4096));
+            assert(all_zero(buf));
+            std::memset(buf.data(), 0xcd, buf.size());
+
+            buf.release();
+            assert(!buf);
+            assert(buf.size() == 0);
+        };
+
+        testcase(alloc_huge_pages) {
+            // MAP_HUGETLB, THP or normal pages, whichever is available
+            page_buffer buf{};
+            const size_t size = 3 * huge_page_size + 1;
+            assert(buf.alloc(size, true));
+            assert(buf.size() == size);
+            assert(all_zero(buf));
+            std::memset(buf.data(), 0xcd, buf.size());
+            if (buf.huge_pages()) {
+                assert(is_aligned(buf.data(), huge_page_size));
+            }
+#ifdef __linux__
+            // anonymous mappings with huge pages requested are 2 MiB aligned even if the OS refuses them
+            assert(is_aligned(buf.data(), huge_page_size));
+#endif
+            // never more than mapped
+            assert(buf.huge_page_bytes() <= 4 * huge_page_size);
+        };
+
+        testcase(grow) {
+            // a larger buffer replaces the old one and is zero-filled again
+            page_buffer buf{};
+            for (const bool huge : {false, true}) {
+                size_t size = 100;
+                for (int i = 0; i < 4; ++i, size *= 37) {
+                    assert(buf.alloc(size, huge));
+                    assert(buf.size() == size);
+                    assert(all_zero(buf));
+                    std::memset(buf.data(), 0xcd, buf.size());
+                }
+            }
+        };
+
+        testcase(move) {
+            page_buffer a{};
+            assert(a.alloc(4096, false));
+            void *p = a.data();
+
+            page_buffer b{std::move(a)};
+            assert(!a);
+            assert(b.data() == p);
+            assert(b.size() == 4096);
+
+            page_buffer c{};
+            assert(c.alloc(100, false));
+            c = std::move(b);
+            assert(!b);
+            assert(c.data() == p);
+            assert(c.size() == 4096);
+        };
+
+        testcase(map_file) {
+            const auto content = make_content(huge_page_size + 12345);
+            temp_file file{"berts_test_memory_map.bin", content};
+
+            for (const bool huge : {false, true}) {
+                page_buffer buf{};
+#ifdef _WIN32
+                assert(!buf.map_file(file.path, huge));
+#else
+                assert(buf.map_file(file.path, huge));
+                assert(buf.is_file_mapping());
+                assert(buf.size() == content.size());
+                assert(std::memcmp(buf.data(), content.data(), content.size()) == 0);
+                if (huge) {
+                    // file offsets and addresses are congruent modulo huge page size
+                    assert(is_aligned(buf.data(), huge_page_size));
+                }
+                assert(buf.huge_page_bytes() <= content.size() + huge_page_size);
+#endif
+            }
+        };
+
+        testcase(map_file_error) {
+            page_buffer buf{};
+            assert(!buf.map_file("/nonexistent/berts_test_memory.bin", false));
+            assert(!buf);
+
+            // empty files cannot be mapped
+            temp_file empty{"berts_test_memory_empty.bin", {}};
+            assert(!buf.map_file(empty.path, true));
+            assert(!buf);
+        };
+
+        testcase(copy) {
+            // weights are copied into an allocated buffer when the file is not mapped
+            const auto content = make_content(2 * huge_page_size + 7);
+            temp_file file{"berts_test_memory_copy.bin", content};
+
+            for (const bool huge : {false, true}) {
+                page_buffer buf{};
+                assert(buf.alloc(content.size(), huge));
+                std::ifstream in{file.path, std::ios::binary};
+                in.read(static_cast<char *>(buf.data()), (std::streamsize)buf.size());
+                assert(in.gcount() == (std::streamsize)content.size());
+                assert(std::memcmp(buf.data(), content.data(), content.size()) == 0);
+            }
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
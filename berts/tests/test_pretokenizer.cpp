@@ -0,0 +1,84 @@
+#include <string>
+#include <vector>
+#include "berts/models/pretokenizer.hpp"
+#include "berts/models/unicode.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+using namespace berts::pretokenizer;
+using namespace berts::unicode;
+
+static const char *gpt2_pattern = R"('s|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+)";
+
+static std::vector<std::string> split(const std::string &s) {
+    std::vector<std::string> pieces;
+    gpt2_split(s, [&pieces](std::string_view piece) {
+        pieces.emplace_back(piece);
+    });
+    return pieces;
+}
+
+static std::vector<std::string> split_regex(regex &re, const std::string &s) {
+    std::vector<ustr> ss;
+    re.split(ustr{s.c_str(), s.size()}, ss);
+    std::vector<std::string> pieces;
+    for (const auto &piece : ss) {
+        pieces.push_back(piece.encode());
+    }
+    return pieces;
+}
+
+test_def {
+    test(pretokenizer) {
+        testcase(gpt2) {
+            using v = std::vector<std::string>;
+            assert(split("") == v{});
+            assert(split("Hello world") == v({"Hello", " world"}));
+            assert(split("I'm don't we'll they're") == v({"I", "'m", " don", "'t", " we", "'ll", " they", "'re"}));
+            assert(split("a  b") == v({"a", " ", " b"}));
+            assert(split("a \n\n b ") == v({"a", " \n\n", " b", " "}));
+            assert(split("a\nb") == v({"a", "\n", "b"}));
+            assert(split("abc123!? x") == v({"abc", "123", "!?", " x"}));
+            assert(split("''s 's") == v({"''", "s", " '", "s"}));
+            // U+00A0 and U+3000 are spaces but only ' ' is joined to the next word; U+3042 is a letter
+            assert(split("\xe3\x81\x82\xc2\xa0\xe3\x80\x80x") == v({"\xe3\x81\x82", "\xc2\xa0", "\xe3\x80\x80", "x"}));
+        };
+
+        testcase(invalid_utf8) {
+            // invalid bytes are kept as they are
+            using v = std::vector<std::string>;
+            assert(split("a\xff\xfe b") == v({"a", "\xff\xfe", " b"}));
+            assert(split("a\xe3\x81") == v({"a", "\xe3\x81"}));
+        };
+
+        testcase(parity) {
+            // the same result as ICU regex
+            regex re{gpt2_pattern};
+            assert(re);
+
+            const std::vector<unic32_t> pool{
+                'a', 'Z', 's', 't', 'r', 'e', 'v', 'l', 'm', 'd', '1', '\'', '!', ' ', ' ', ' ',
+                '\t', '\n', '\r', 0x0b, 0x0c, 0x85, 0xa0, 0x1680, 0x2000, 0x2028, 0x202f, 0x3000,
+                0x00e0, 0x0300, 0x0660, 0x2160, 0x00b2, 0x3042, 0x4e00, 0xff01, 0x1f600, 0x0000,
+            };
+            std::string s;
+            uint32_t x = 88675123u;
+            for (size_t i = 0; i < 100000; ++i) {
+                s.clear();
+                for (size_t n = 1 + i % 12; n != 0; --n) {
+                    x ^= x << 13;
+                    x ^= x >> 17;
+                    x ^= x << 5;
+                    encode_utf8(pool[x % pool.size()], s);
+                }
+                assert(split(s) == split_regex(re, s));
+            }
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
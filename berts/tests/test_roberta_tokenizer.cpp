@@ -1,10 +1,14 @@
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 #include "berts/berts.h"
 #include "berts/models/fmt.hpp"
+#include "berts/models/internal.hpp"
 
 #define BERTS_TEST_SHORTHAND
+#include "berts/tests/alloc_counter.hpp"
 #include "berts/tests/tests.hpp"
 
 test_def {
@@ -159,6 +163,124 @@ test_def {
             assert(tokens[11] == 116);  // "?"
             assert(tokens[12] == 2);    // "</s>"
         };
+
+        testcase(tokenize_into) {
+            const std::string text1 = "Hi, I am <mask> man.";
+            std::array<bert_token_t, 16> tokens{};
+            std::array<berts_token_span, 16> spans{};
+            size_t size = tokens.size();
+            bool ok = berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), spans.data(), &size);
+            assert(ok);
+            assert(size == 9);
+
+            // byte-level tokens include the leading space
+            const std::array<berts_token_span, 9> expected{{
+                {0, 0},   // "<s>"
+                {0, 2},   // "Hi"
+                {2, 3},   // ","
+                {3, 5},   // " I"
+                {5, 8},   // " am"
+                {9, 15},  // "<mask>"
+                {15, 19}, // " man"
+                {19, 20}, // "."
+                {20, 20}, // "</s>"
+            }};
+            for (size_t i = 0; i < size; ++i) {
+                assert(spans[i].begin == expected[i].begin);
+                assert(spans[i].end == expected[i].end);
+            }
+
+            // same as berts_tokenize
+            size_t size1 = text1.size() + 2;
+            std::vector<bert_token_t> tokens1(size1);
+            assert(berts_tokenize(ctx, text1.c_str(), tokens1.data(), &size1));
+            assert(size1 == size);
+            assert(std::equal(tokens1.begin(), tokens1.begin() + size1, tokens.begin()));
+        };
+
+        testcase(tokenize_into_no_alloc) {
+            // once the per-thread buffers and the piece cache are warmed up, no heap memory is allocated
+            const auto level = berts_get_log_level();
+            berts_set_log_level(BERTS_LOG_WARN);
+
+            const std::string text1 = "Hi, I am <mask> man. How are you?";
+            std::array<bert_token_t, 32> tokens{};
+            std::array<berts_token_span, 32> spans{};
+            size_t size = tokens.size();
+            assert(berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), spans.data(), &size));
+
+            const size_t n0 = berts::tests::alloc_count();
+            for (size_t i = 0; i < 100; ++i) {
+                size = tokens.size();
+                assert(berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), spans.data(), &size));
+                size = tokens.size();
+                assert(berts_tokenize_into(ctx, text1.data(), text1.size(), nullptr, tokens.data(), nullptr, &size));
+            }
+            const size_t n1 = berts::tests::alloc_count();
+
+            berts_set_log_level(level);
+
+            assert(size == 13);
+            assert(n0 == n1);
+        };
+
+        testcase(cache) {
+            // pieces are cached across calls
+            const std::string text1 = "Hello, persistent cache.";
+            size_t size1 = text1.size() + 2, size2 = size1;
+            std::unique_ptr<bert_token_t[]> tokens1{new bert_token_t[size1]};
+            std::unique_ptr<bert_token_t[]> tokens2{new bert_token_t[size2]};
+
+            berts_tokenizer_cache_stats before{}, after{};
+            assert(berts_tokenize(ctx, text1.c_str(), tokens1.get(), &size1));
+            assert(berts_get_tokenizer_cache_stats(ctx, &before));
+            assert(berts_tokenize(ctx, text1.c_str(), tokens2.get(), &size2));
+            assert(berts_get_tokenizer_cache_stats(ctx, &after));
+
+            assert(size1 == size2);
+            assert(std::equal(tokens1.get(), tokens1.get() + size1, tokens2.get()));
+            assert(0 < before.entries);
+            assert(before.entries <= before.capacity);
+            assert(before.hits < after.hits);
+            assert(before.misses == after.misses);
+        };
+
+        testcase(tokenize_long_text) {
+            // a long text is split into chunks and tokenized in parallel if requested;
+            // ids and spans must be the same as tokenizing it on one thread
+            std::string text;
+            for (size_t i = 0; text.size() < 1'000'000; ++i) {
+                text += berts::fmt::fmt("Hi, I'm   <mask> man No.{}. We'll  meet at the café, don't you?", i);
+                text += i % 5 == 0 ? " 日本語の文章です。" : "";
+                text += i % 7 == 0 ? "\t\n\n  " : "   ";
+            }
+
+            berts_tokenize_info cond{};
+            berts_init_tokenize_info(&cond);
+            cond.n_threads = 4;
+
+            size_t size = text.size() + 2;
+            std::vector<bert_token_t> tokens(size);
+            std::vector<berts_token_span> spans(size);
+            bool ok = berts_tokenize_into(ctx, text.data(), text.size(), &cond, tokens.data(), spans.data(), &size);
+            assert(ok);
+            tokens.resize(size);
+            spans.resize(size);
+
+            std::vector<bert_token_t> tokens1;
+            std::vector<berts_token_span> spans1;
+            ok = berts::internal::get_model(ctx).tokenize(ctx, text, tokens1, &spans1, 1);
+            assert(ok);
+
+            // without <s> and </s>
+            assert(tokens1.size() + 2 == size);
+            assert(std::equal(tokens1.begin(), tokens1.end(), tokens.begin() + 1));
+            assert(spans1.size() + 2 == size);
+            for (size_t i = 0; i < spans1.size(); ++i) {
+                assert(spans1[i].begin == spans[i + 1].begin);
+                assert(spans1[i].end == spans[i + 1].end);
+            }
+        };
     };
 };
 
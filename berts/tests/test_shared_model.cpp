@@ -0,0 +1,89 @@
+#include <string>
+#include <vector>
+#include "berts/berts.h"
+#include "berts/models/internal.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+static const char *model_path = ".gguf/bert-base-cased-f32.gguf";
+
+// `true` if both contexts use the same weights and vocab
+static bool shares(const berts_context *a, const berts_context *b) {
+    return &berts::internal::get_model(a) == &berts::internal::get_model(b);
+}
+
+static bool tokenize_and_eval(berts_context *ctx) {
+    const std::string text = "Hi, I am [MASK] man. How are you?";
+    size_t size = text.size() + 2;
+    std::vector<bert_token_t> tokens(size);
+    if (!berts_tokenize(ctx, text.c_str(), tokens.data(), &size) || size != 13) {
+        return false;
+    }
+
+    berts_eval_info cond{};
+    berts_init_eval_info(&cond);
+    cond.pool_type = BERTS_POOL_CLS;
+    size_t out_size = 0;
+    if (!berts_eval(ctx, tokens.data(), nullptr, size, &cond, nullptr, &out_size) || out_size == 0) {
+        return false;
+    }
+    std::vector<float> out(out_size);
+    return berts_eval(ctx, tokens.data(), nullptr, size, &cond, out.data(), &out_size);
+}
+
+test_def {
+    test(shared_model) {
+        berts_set_log_level(BERTS_LOG_WARN);
+
+        testcase(same_params) {
+            berts_load_params params{};
+            berts_init_load_params(&params);
+
+            auto ctx1 = berts_load_from_file_with_params(model_path, &params);
+            auto ctx2 = berts_load_from_file_with_params(model_path, &params);
+            assert(ctx1);
+            assert(ctx2);
+            assert(ctx1 != ctx2);
+            assert(shares(ctx1, ctx2));
+
+            // weights outlive the context which loaded them
+            berts_free(ctx1);
+            assert(tokenize_and_eval(ctx2));
+
+            berts_free(ctx2);
+        };
+
+        testcase(different_params) {
+            berts_load_params params{};
+            berts_init_load_params(&params);
+            berts_load_params mapped = params;
+            mapped.use_mmap = !params.use_mmap;
+
+            auto ctx1 = berts_load_from_file_with_params(model_path, &params);
+            auto ctx2 = berts_load_from_file_with_params(model_path, &mapped);
+            assert(ctx1);
+            assert(ctx2);
+            assert(!shares(ctx1, ctx2));
+            assert(tokenize_and_eval(ctx2));
+
+            // each copy is still shared with loaders using the same params
+            auto ctx3 = berts_load_from_file_with_params(model_path, &params);
+            auto ctx4 = berts_load_from_file_with_params(model_path, &mapped);
+            assert(ctx3);
+            assert(ctx4);
+            assert(shares(ctx1, ctx3));
+            assert(shares(ctx2, ctx4));
+
+            berts_free(ctx4);
+            berts_free(ctx3);
+            berts_free(ctx2);
+            berts_free(ctx1);
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "berts/models/token_matcher.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+using berts::token_matcher;
+
+using pieces_t = std::vector<std::pair<std::string, bert_token_t>>;
+
+static pieces_t split(const token_matcher &m, const std::string &text) {
+    pieces_t pieces;
+    m.split(text, [&pieces](std::string_view piece, bert_token_t id) {
+        pieces.emplace_back(piece, id);
+        return true;
+    });
+    return pieces;
+}
+
+static constexpr bert_token_t X = BERTS_INVALID_TOKEN_ID;
+
+test_def {
+    test(token_matcher) {
+        const token_matcher::entry tokens[] = {
+            {"<s>", 0},
+            {"</s>", 2},
+            {"<mask>", 4},
+            {"<m", 5},
+            {"", 6}, // ignored
+            {"\xe3\x80\x90X\xe3\x80\x91", 7},
+        };
+
+        testcase(empty) {
+            token_matcher m;
+            assert(m.empty());
+            assert(m.build({}));
+            assert(m.empty());
+            assert(split(m, "abc") == pieces_t({{"abc", X}}));
+            assert(split(m, "") == pieces_t{});
+            assert(m.exact("abc") == X);
+        };
+
+        testcase(find) {
+            token_matcher m;
+            assert(m.build(tokens));
+            assert(!m.empty());
+
+            token_matcher::match r;
+            assert(m.find("ab<s>cd", 0, r));
+            assert(r.begin == 2 && r.size == 3 && r.id == 0);
+            assert(!m.find("ab<s>cd", 3, r));
+            assert(!m.find("ab<", 0, r));
+
+            // the longest one wins
+            assert(m.find("x<mask>", 0, r));
+            assert(r.begin == 1 && r.size == 6 && r.id == 4);
+            assert(m.find("x<mas", 0, r));
+            assert(r.begin == 1 && r.size == 2 && r.id == 5);
+        };
+
+        testcase(split) {
+            token_matcher m;
+            assert(m.build(tokens));
+            assert(split(m, "<s>abc <mask>def</s>") == pieces_t({{"<s>", 0}, {"abc ", X}, {"<mask>", 4}, {"def", X}, {"</s>", 2}}));
+            assert(split(m, "<s></s>") == pieces_t({{"<s>", 0}, {"</s>", 2}}));
+            assert(split(m, "a<<s>") == pieces_t({{"a<", X}, {"<s>", 0}}));
+            assert(split(m, "\xe3\x81\x82\xe3\x80\x90X\xe3\x80\x91") == pieces_t({{"\xe3\x81\x82", X}, {"\xe3\x80\x90X\xe3\x80\x91", 7}}));
+
+            // stop at `false`
+            size_t n = 0;
+            assert(!m.split("a<s>b<s>c", [&n](std::string_view, bert_token_t) { return ++n < 2; }));
+            assert(n == 2);
+        };
+
+        testcase(exact) {
+            token_matcher m;
+            assert(m.build(tokens));
+            assert(m.exact("<mask>") == 4);
+            assert(m.exact("<m") == 5);
+            assert(m.exact("<ma") == X);
+            assert(m.exact("<mask> ") == X);
+            assert(m.exact("") == X);
+
+            m.clear();
+            assert(m.empty());
+            assert(m.exact("<mask>") == X);
+        };
+
+        testcase(linear) {
+            // "<s" repeated: every position starts a partial match, but the scan must stay linear
+            token_matcher m;
+            assert(m.build(tokens));
+
+            std::string text;
+            for (size_t i = 0; i < 1000000; ++i) {
+                text += "<s";
+            }
+            text += "<s>";
+
+            const auto t0 = std::chrono::high_resolution_clock::now();
+            const auto pieces = split(m, text);
+            const auto t1 = std::chrono::high_resolution_clock::now();
+            std::cout << "split " << text.size() << " bytes: "
+                      << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " ms" << std::endl;
+
+            assert(pieces.size() == 2);
+            assert(pieces[0].first.size() == text.size() - 3 && pieces[0].second == X);
+            assert(pieces[1].first == "<s>" && pieces[1].second == 0);
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
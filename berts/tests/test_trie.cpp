@@ -1,4 +1,9 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
 #include "berts/models/trie.hpp"
 
 #define BERTS_TEST_SHORTHAND
@@ -21,6 +26,29 @@ struct default_delete<trie> {
 
 using trie_t = std::unique_ptr<trie>;
 
+// deterministic pseudo-random vocab like WordPiece (words, "##" pieces and some multibyte tokens)
+static std::vector<std::string> make_vocab(size_t n) {
+    static const char *const multibyte[] = {"\xc3\xa9", "\xe3\x81\x82", "\xe4\xb8\x80", "\xf0\x9f\x98\x80"};
+    berts::tests::xorshift32 next{};
+
+    std::vector<std::string> vocab;
+    vocab.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::string token = next() % 3 == 0 ? "##" : "";
+        const size_t len = 1 + next() % 8;
+        for (size_t j = 0; j < len; ++j) {
+            const auto r = next() % 32;
+            if (r < 26) {
+                token += (char)('a' + r);
+            } else {
+                token += multibyte[r % 4];
+            }
+        }
+        vocab.push_back(std::move(token));
+    }
+    return vocab;
+}
+
 test_def {
     test(trie) {
         std::vector<std::string> vocab{{
@@ -124,6 +152,83 @@ test_def {
             assert(rest == "");
         };
 
+        testcase(search_trie_substr_view) {
+            // found and rest are slices in UTF-16 code units
+            std::vector<std::string> vocab2{"a\xf0\x9f\x98\x80", "\xe3\x81\x82"};
+            auto t2 = build_trie(vocab2);
+            const ustr s{"a\xf0\x9f\x98\x80\xe3\x81\x82"}; // a U+1F600 U+3042
+            ustr_view found, rest;
+            auto id = search_trie_substr(trie_root(t2), s.view(), found, rest);
+            assert(id == 0);
+            assert(found.data() == s.begin() && found.size() == 3);
+            assert(rest.data() == s.begin() + 3 && rest.size() == 1);
+            id = search_trie_substr(trie_root(t2), rest, found, rest);
+            assert(id == 1);
+            assert(found == ustr{"\xe3\x81\x82"});
+            assert(rest.empty());
+
+            free_trie(t2);
+        };
+
+        // overlapping prefixes must not hide the longest match
+        testcase(search_trie_substr_longest) {
+            std::vector<std::string> vocab2{"ab", "abcde"};
+            auto t2 = build_trie(vocab2);
+            std::string found, rest;
+            auto id = search_trie_substr(t2, "abcd", found, rest);
+            assert(id == 0);
+            assert(found == "ab");
+            assert(rest == "cd");
+
+            size_t len = 0;
+            id = search_trie_substr(trie_root(t2), std::string_view{"abcdef"}, len);
+            assert(id == 1);
+            assert(len == 5);
+
+            free_trie(t2);
+        };
+
+        testcase(throughput) {
+            const auto vocab2 = make_vocab(30000);
+            auto t2 = build_trie(vocab2);
+            assert(t2);
+
+            std::unordered_map<std::string, bert_token_t> ref;
+            for (size_t id = 0; id < vocab2.size(); ++id) {
+                ref.emplace(vocab2[id], (bert_token_t)id);
+            }
+
+            // the same lookups as a naive map
+            for (const auto &token : vocab2) {
+                assert(search_trie(t2, token) == ref[token]);
+            }
+
+            std::string text;
+            for (size_t i = 0; text.size() < 1'000'000; i = (i * 7 + 3) % vocab2.size()) {
+                text += vocab2[i];
+            }
+
+            const auto root = trie_root(t2);
+            const auto start = std::chrono::steady_clock::now();
+            size_t n_tokens = 0;
+            for (std::string_view rest{text}; !rest.empty();) {
+                size_t len = 1;
+                if (search_trie_substr(root, rest, len) != BERTS_INVALID_TOKEN_ID) {
+                    ++n_tokens;
+                }
+                rest.remove_prefix(len);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+            assert(n_tokens != 0);
+            std::cout << "  trie: " << vocab2.size() << " tokens, "
+                      << trie_memory_size(t2) << " bytes, "
+                      << (double)ns / text.size() << " ns/byte" << std::endl;
+
+            free_trie(t2);
+        };
+
         testcase(trie_free) {
             assert(check_trie_free == 1);
             {
@@ -1,3 +1,5 @@
+#include <string>
+#include <vector>
 #include "berts/models/unicode.hpp"
 
 #define BERTS_TEST_SHORTHAND
@@ -134,6 +136,69 @@ test_def {
             assert(f == g);
         };
 
+        // inline storage <-> heap
+        testcase(small_string) {
+            const ustr small{"abc"};
+            const ustr large{"abcdefghijklmnopqrstuvwxyz"};
+            assert(small.packsize() == 3);
+            assert(large.packsize() == 26);
+            assert(small.encode() == "abc");
+            assert(large.encode() == "abcdefghijklmnopqrstuvwxyz");
+
+            // copy and move in both directions
+            ustr a = small;
+            ustr b = large;
+            assert(a == small && b == large);
+            a = large;
+            b = small;
+            assert(a == large && b == small);
+            ustr c = std::move(a);
+            ustr d = std::move(b);
+            assert(c == large && d == small);
+            assert(a.empty() && b.empty());
+            c = std::move(d);
+            assert(c == small);
+
+            // grow past the inline buffer, also from itself
+            ustr e{"abcdefgh"};
+            e += e;
+            assert(e == ustr{"abcdefghabcdefgh"});
+            e += e.substr(0, 2);
+            assert(e == ustr{"abcdefghabcdefghab"});
+
+            // empty strings are never null
+            const ustr empty{""};
+            assert(empty.empty());
+            assert(empty == ustr{});
+            assert(empty.begin() == empty.end());
+        };
+
+        testcase(ustr_view) {
+            const ustr s{"a\xe3\x81\x82\xf0\x9f\x98\x80z"}; // a U+3042 U+1F600 z
+            const ustr_view v = s;
+            assert(v.size() == 5);
+            assert(v.codepoints() == 4);
+            assert(v.data() == s.begin());
+
+            assert(v.substr(1, 1).encode() == "\xe3\x81\x82");
+            assert(v.substr(2, 2).encode() == "\xf0\x9f\x98\x80");
+            assert(v.substr(4) == ustr{"z"});
+            assert(v.substr(10).empty());
+            assert(v.starts_with(ustr{"a"}));
+            assert(v.ends_with(ustr{"z"}));
+            assert(!v.starts_with(ustr{"z"}));
+
+            // a broken surrogate pair is not encoded
+            std::string out{"x"};
+            assert(!v.substr(2, 1).encode_to(out));
+            assert(out.empty());
+
+            assert(ustr_view{} == ustr{});
+            assert((ustr{"ab"} <=> ustr{"abc"}) < 0);
+            assert((v.substr(0, 1) <=> ustr{"b"}) < 0);
+            assert(ustr{v.substr(0, 2)} == ustr{"a\xe3\x81\x82"});
+        };
+
         //
         // NFC
         //
@@ -181,6 +246,191 @@ test_def {
             assert(ok);
             assert(a2 == b1);
         };
+
+        //
+        // case mapping
+        //
+
+        testcase(to_lower) {
+            const ustr a1{"ABC\xc3\x80"}; // ABCÀ
+            ustr a2;
+            const ustr b1{"abc\xc3\xa0"}; // abcà
+            bool ok = to_lower(a1, a2);
+            assert(ok);
+            assert(a2 == b1);
+        };
+
+        //
+        // UTF-8
+        //
+
+        testcase(utf8_decode) {
+            const std::string s{"a\xc3\xa0\xe3\x81\x82\xf0\x9f\x98\x80"}; // a à あ 😀
+            std::vector<unic32_t> cps;
+            std::string t;
+            for (size_t i = 0; i < s.size();) {
+                const auto c = decode_utf8(s, i);
+                cps.push_back(c);
+                encode_utf8(c, t);
+            }
+            assert(cps == std::vector<unic32_t>({0x61, 0xe0, 0x3042, 0x1f600}));
+            assert(t == s);
+        };
+
+        testcase(utf8_decode_invalid) {
+            // lone continuation, overlong, surrogate, truncated
+            for (const std::string s : {"\x80", "\xc0\xaf", "\xed\xa0\x80", "\xe3\x81"}) {
+                size_t i = 0;
+                assert(decode_utf8(s, i) == 0xfffd);
+                assert(i == 1);
+            }
+        };
+
+        testcase(ascii_span) {
+            // every length and position of the first non-ASCII byte, across vector widths
+            for (size_t n = 0; n < 80; ++n) {
+                std::string s(n, 'a');
+                assert(ascii_span(s) == n);
+                assert(is_ascii(s));
+                for (size_t k = 0; k < n; ++k) {
+                    std::string t = s;
+                    t[k] = '\xe3';
+                    assert(ascii_span(t) == k);
+                    assert(!is_ascii(t));
+                }
+            }
+        };
+
+        testcase(property_tables) {
+            for (unic32_t c = 0; c <= 0x10ffff; ++c) {
+                const std::string k = category(c);
+                assert(is_nonspacing_mark(c) == (k == "Mn"));
+                assert(is_control(c) == (k[0] == 'C'));
+                assert(is_letter(c) == (k[0] == 'L'));
+                assert(is_number(c) == (k[0] == 'N'));
+                if (k[0] == 'P') {
+                    assert(is_punct(c));
+                }
+            }
+            assert(is_whitespace('\t'));
+            assert(is_whitespace(0x3000)); // IDEOGRAPHIC SPACE
+            assert(!is_whitespace('\n'));
+            assert(is_punct('$'));
+            assert(is_punct('^'));
+            assert(is_cjk(0x4e00));
+            assert(!is_cjk(0x3042));
+            assert(is_control(-1));
+            assert(is_control(0x110000));
+        };
+
+        testcase(utf8_normalize) {
+            std::string a;
+            assert(normalize_nfc("\x61\xcc\x80", a));
+            assert(a == "\xc3\xa0");
+            assert(normalize_nfd("\xe3\x81\x8c", a));
+            assert(a == "\xe3\x81\x8b\xe3\x82\x99");
+        };
+
+        testcase(quick_check) {
+            // conservative: combining marks always fail
+            assert(is_nfc("abc\xc3\xa0"));
+            assert(!is_nfc("a\xcc\x80"));
+            assert(is_nfd("abc\xe3\x81\x82"));
+            assert(!is_nfd("abc\xc3\xa0"));
+            assert(is_nfc(""));
+
+            // spans which fail the quick check are normalized; the result is the same as ICU
+            auto reference = [](const std::string &s, bool nfc) {
+                ustr u{s.c_str(), s.size()}, v;
+                nfc ? normalize_nfc(u, v) : normalize_nfd(u, v);
+                return v.encode();
+            };
+
+            const std::vector<unic32_t> pool{
+                'a', 'e', ' ', 0x00e0, 0x00c5, 0x212b, 0x0300, 0x0301, 0x0327, 0x0323,
+                0x1100, 0x1161, 0x11a8, 0xac00, 0x0b47, 0x0b3e, 0x0b57, 0x3042, 0x304b, 0x3099,
+                0x1d15e, 0x1d165, 0x1d16e, 0xf900,
+            };
+            std::string s, a;
+            uint32_t x = 88675123u;
+            for (size_t i = 0; i < 100000; ++i) {
+                s.clear();
+                for (size_t n = 1 + i % 10; n != 0; --n) {
+                    x ^= x << 13;
+                    x ^= x >> 17;
+                    x ^= x << 5;
+                    encode_utf8(pool[x % pool.size()], s);
+                }
+                assert(normalize_nfc(s, a));
+                assert(a == reference(s, true));
+                assert(normalize_nfd(s, a));
+                assert(a == reference(s, false));
+            }
+
+            // ill-formed sequences are replaced with U+FFFD like the whole-text normalization
+            assert(normalize_nfc("a\xe3\x81" "b\xc3\xa0", a));
+            assert(a == "a\xef\xbf\xbd" "b\xc3\xa0");
+        };
+
+        testcase(utf8_to_lower) {
+            std::string a;
+            assert(to_lower("ABC\xc3\x80", a));
+            assert(a == "abc\xc3\xa0");
+            // final sigma: ΟΔΟΣ -> οδος
+            assert(to_lower("\xce\x9f\xce\x94\xce\x9f\xce\xa3", a));
+            assert(a == "\xce\xbf\xce\xb4\xce\xbf\xcf\x82");
+            // expansion: İ -> i + U+0307
+            assert(to_lower("\xc4\xb0", a));
+            assert(a == "i\xcc\x87");
+        };
+
+        testcase(lower_strip_accents) {
+            // lowercase -> NFD -> remove Mn -> NFC
+            auto reference = [](const std::string &s) {
+                std::string lower, nfd, stripped, out;
+                to_lower(s, lower);
+                normalize_nfd(lower, nfd);
+                for (size_t i = 0; i < nfd.size();) {
+                    const size_t start = i;
+                    if (!is_nonspacing_mark(decode_utf8(nfd, i))) {
+                        stripped.append(nfd, start, i - start);
+                    }
+                }
+                normalize_nfc(stripped, out);
+                return out;
+            };
+
+            std::string s, a;
+            for (unic32_t c = 0; c <= 0x10ffff; ++c) {
+                if (0xd800 <= c && c < 0xe000) continue;
+                s.clear();
+                encode_utf8(c, s);
+                assert(lower_strip_accents(s, a));
+                assert(a == reference(s));
+            }
+
+            assert(lower_strip_accents("\xc3\x80" "Bc\xc3\xa9", a));
+            assert(a == "abce");
+
+            // chars which depend on neighbors
+            const std::vector<unic32_t> pool{
+                'A', 'e', 'I', 0x0130, 0x0131, 0x212a, 0x00c5, 0x00df, // Latin
+                0x03a3, 0x03c3, 0x039f, 0x0390, 0x1f88, 0x0345,     // Greek
+                0x0300, 0x0301, 0x0327, 0x0308, 0x0903, 0x20dd,     // combining marks
+                0x1100, 0x1161, 0x11a8, 0xac00,                     // Hangul
+                0x0b47, 0x0b3c, 0x0b3e, 0x0b57,                     // Oriya
+                0x1d165, 0x1d16e, '.', '\'', 0x3042, 0x3099,
+            };
+            berts::tests::xorshift32 next{};
+            for (size_t i = 0; i < 100000; ++i) {
+                s.clear();
+                for (size_t n = 1 + i % 8; n != 0; --n) {
+                    encode_utf8(pool[next() % pool.size()], s);
+                }
+                assert(lower_strip_accents(s, a));
+                assert(a == reference(s));
+            }
+        };
     };
 };
 
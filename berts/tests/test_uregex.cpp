@@ -186,6 +186,22 @@ test_def {
             assert(ss1[3] == ustr{"a"});
             assert(ss1[4] == ustr{"ef"});
         };
+
+        testcase(split_view) {
+            // pieces are views of the input
+            std::vector<ustr_view> ss1{};
+            regex re1{"(a|c)+"};
+            ustr s1{"bacdaef"};
+            assert(re1);
+            assert(re1.split(s1, ss1) == 5);
+            assert(ss1[0] == ustr{"b"});
+            assert(ss1[1] == ustr{"ac"});
+            assert(ss1[2] == ustr{"d"});
+            assert(ss1[3] == ustr{"a"});
+            assert(ss1[4] == ustr{"ef"});
+            assert(ss1[0].data() == s1.begin());
+            assert(ss1[4].data() == s1.begin() + 5);
+        };
     };
 };
 
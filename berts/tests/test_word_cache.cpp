@@ -0,0 +1,137 @@
+#include <string>
+#include <thread>
+#include <vector>
+#include "berts/models/word_cache.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+using namespace berts;
+
+static std::string key(bert_token_t i) {
+    // long enough to be cached
+    return "word" + std::to_string(i) + "########";
+}
+
+test_def {
+    test(word_cache) {
+        testcase(find_insert) {
+            word_cache cache{};
+            std::vector<bert_token_t> out{99};
+
+            assert(!cache.find("unaffableness", out));
+            cache.insert("unaffableness", std::vector<bert_token_t>{7, 8, 9});
+            assert(cache.find("unaffableness", out));
+            assert(out == std::vector<bert_token_t>({99, 7, 8, 9}));
+
+            // empty ids are also cached
+            cache.insert("##############", std::vector<bert_token_t>{});
+            assert(cache.find("##############", out));
+            assert(out.size() == 4);
+
+            const auto stats = cache.get_stats();
+            assert(stats.hits == 2);
+            assert(stats.misses == 1);
+            assert(stats.entries == 2);
+            assert(stats.capacity == word_cache::default_capacity);
+
+            cache.clear();
+            assert(!cache.find("unaffableness", out));
+            assert(cache.get_stats().entries == 0);
+        };
+
+        testcase(disabled) {
+            word_cache cache{0};
+            std::vector<bert_token_t> out;
+            cache.insert("unaffableness", std::vector<bert_token_t>{1});
+            assert(!cache.find("unaffableness", out));
+            assert(cache.get_stats().entries == 0);
+        };
+
+        testcase(word_size) {
+            word_cache cache{};
+            std::vector<bert_token_t> out;
+            const std::string long_word(word_cache::max_word_size + 1, 'a');
+            const std::string short_word(word_cache::min_word_size - 1, 'a');
+            assert(!cache.accepts(long_word));
+            assert(!cache.accepts(short_word));
+            cache.insert(long_word, std::vector<bert_token_t>{1});
+            cache.insert(short_word, std::vector<bert_token_t>{1});
+            assert(!cache.find(long_word, out));
+            assert(!cache.find(short_word, out));
+            assert(cache.get_stats().entries == 0);
+        };
+
+        testcase(bounded) {
+            const size_t capacity = 1024;
+            word_cache cache{capacity};
+            std::vector<bert_token_t> out;
+            for (bert_token_t i = 0; i < 100000; ++i) {
+                cache.insert(key(i), std::vector<bert_token_t>{i, i + 1});
+                assert(cache.get_stats().entries <= capacity + word_cache::n_shards);
+            }
+
+            // the last one is always kept
+            assert(cache.find(key(99999), out));
+            assert(out == std::vector<bert_token_t>({99999, 100000}));
+        };
+
+        testcase(second_chance) {
+            // a word which is hit between insertions is never evicted
+            word_cache cache{word_cache::n_shards * 4};
+            std::vector<bert_token_t> out;
+            const std::string hot = "##hot#word##";
+            cache.insert(hot, std::vector<bert_token_t>{42});
+            for (bert_token_t i = 0; i < 10000; ++i) {
+                cache.insert(key(i), std::vector<bert_token_t>{i});
+                out.clear();
+                assert(cache.find(hot, out));
+                assert(out == std::vector<bert_token_t>{42});
+            }
+            assert(cache.get_stats().entries <= word_cache::n_shards * 4);
+        };
+
+        testcase(min_size) {
+            word_cache cache{word_cache::default_capacity, 2};
+            std::vector<bert_token_t> out;
+            assert(!cache.accepts("a"));
+            assert(cache.accepts("ab"));
+            cache.insert("ab", std::vector<bert_token_t>{1, 2});
+            assert(cache.find("ab", out));
+            assert(out == std::vector<bert_token_t>({1, 2}));
+        };
+
+        testcase(concurrent) {
+            word_cache cache{4096};
+            std::vector<std::jthread> threads;
+            std::vector<int> ok(8, 1);
+            for (size_t t = 0; t < ok.size(); ++t) {
+                threads.emplace_back([&cache, &ok, t]() {
+                    std::vector<bert_token_t> out;
+                    for (bert_token_t i = 0; i < 20000; ++i) {
+                        const bert_token_t k = (i * 7 + (bert_token_t)t) % 10000;
+                        const auto word = key(k);
+                        out.clear();
+                        if (cache.find(word, out)) {
+                            if (out != std::vector<bert_token_t>{k, k * 2}) ok[t] = 0;
+                        } else {
+                            cache.insert(word, std::vector<bert_token_t>{k, k * 2});
+                        }
+                    }
+                });
+            }
+            threads.clear();
+
+            for (const auto x : ok) {
+                assert(x == 1);
+            }
+            const auto stats = cache.get_stats();
+            assert(stats.hits + stats.misses == 8 * 20000);
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
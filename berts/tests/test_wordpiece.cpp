@@ -0,0 +1,176 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "berts/models/trie.hpp"
+#include "berts/models/wordpiece.hpp"
+
+#define BERTS_TEST_SHORTHAND
+#include "berts/tests/tests.hpp"
+
+using namespace berts::trie;
+using namespace berts::wordpiece;
+
+static constexpr bert_token_t unk = 9999;
+
+// greedy longest-match-first (transformers.WordpieceTokenizer)
+static std::vector<bert_token_t> reference(const trie *t, std::string_view word) {
+    std::vector<bert_token_t> out;
+    const auto root = trie_root(t);
+    const auto cont = search_node(root, std::string_view{"##"});
+    auto node = root;
+    while (!word.empty()) {
+        size_t len = 0;
+        const auto id = search_trie_substr(node, word, len);
+        if (id == BERTS_INVALID_TOKEN_ID) {
+            return {unk};
+        }
+        out.push_back(id);
+        word.remove_prefix(len);
+        node = cont;
+    }
+    return out;
+}
+
+static std::vector<bert_token_t> tokenize(const wordpiece &wp, std::string_view word) {
+    std::vector<bert_token_t> out;
+    wp.tokenize(word, unk, out);
+    return out;
+}
+
+static std::string random_word(berts::tests::xorshift32 &next, size_t max_len, uint32_t n_chars) {
+    std::string word;
+    const size_t len = 1 + next() % max_len;
+    for (size_t j = 0; j < len; ++j) {
+        word += (char)('a' + next() % n_chars);
+    }
+    return word;
+}
+
+test_def {
+    test(wordpiece) {
+        std::vector<std::string> vocab{{
+            "a",      // 0
+            "abcdx",  // 1
+            "##b",    // 2
+            "##c",    // 3
+            "##cdy",  // 4
+            "##dz",   // 5
+            "##d",    // 6
+            "un",     // 7
+            "##aff",  // 8
+            "##able", // 9
+            "##z",    // 10
+        }};
+
+        auto t = build_trie(vocab);
+        wordpiece wp{};
+        const bool built = wp.build(t, "##");
+
+        testcase(build) {
+            assert(built);
+            assert(!wp.empty());
+
+            wordpiece wp2{};
+            assert(!wp2.build(t, "@@"));
+            assert(wp2.empty());
+        };
+
+        // example in the paper
+        testcase(abcdz) {
+            auto ids = tokenize(wp, "abcdz");
+            assert(ids == std::vector<bert_token_t>({0, 2, 3, 5}));
+        };
+
+        testcase(unaffable) {
+            auto ids = tokenize(wp, "unaffable");
+            assert(ids == std::vector<bert_token_t>({7, 8, 9}));
+        };
+
+        testcase(whole_word_unk) {
+            // "abcd" + "q": the pieces emitted so far must be discarded
+            auto ids = tokenize(wp, "abcdq");
+            assert(ids == std::vector<bert_token_t>({unk}));
+
+            ids = tokenize(wp, "q");
+            assert(ids == std::vector<bert_token_t>({unk}));
+
+            std::vector<bert_token_t> out{1, 2, 3};
+            assert(!wp.tokenize("abcdq", unk, out));
+            assert(out == std::vector<bert_token_t>({1, 2, 3, unk}));
+        };
+
+        testcase(suffix_indicator_in_word) {
+            auto ids = tokenize(wp, "##b");
+            assert(ids == reference(t, "##b"));
+            ids = tokenize(wp, "##bc");
+            assert(ids == reference(t, "##bc"));
+            ids = tokenize(wp, "a##b");
+            assert(ids == reference(t, "a##b"));
+        };
+
+        testcase(same_as_greedy) {
+            berts::tests::xorshift32 next{};
+            for (size_t i = 0; i < 100000; ++i) {
+                const auto word = random_word(next, 12, 6);
+                assert(tokenize(wp, word) == reference(t, word));
+            }
+        };
+
+        testcase(throughput) {
+            berts::tests::xorshift32 next{};
+
+            std::vector<std::string> vocab2;
+            for (size_t i = 0; i < 30000; ++i) {
+                auto token = random_word(next, 6, 26);
+                vocab2.push_back(i % 3 == 0 ? token : "##" + token);
+            }
+            for (char c = 'a'; c <= 'z'; ++c) {
+                vocab2.push_back(std::string{c});
+                vocab2.push_back(std::string{"##"} + c);
+            }
+
+            auto t2 = build_trie(vocab2);
+            wordpiece wp2{};
+            assert(wp2.build(t2, "##"));
+
+            std::vector<std::string> words;
+            size_t bytes = 0;
+            while (bytes < 1'000'000) {
+                words.push_back(random_word(next, 24, 26));
+                bytes += words.back().size();
+            }
+
+            // a very long word must not take quadratic time
+            words.push_back(std::string(100'000, 'a'));
+            bytes += words.back().size();
+
+            for (size_t i = 0; i < 1000; ++i) {
+                assert(tokenize(wp2, words[i]) == reference(t2, words[i]));
+            }
+
+            std::vector<bert_token_t> out;
+            out.reserve(bytes);
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto &word : words) {
+                wp2.tokenize(word, unk, out);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+            assert(!out.empty());
+            std::cout << "  wordpiece: " << out.size() << " tokens, "
+                      << wp2.memory_size() << " bytes, "
+                      << (double)ns / bytes << " ns/byte" << std::endl;
+
+            free_trie(t2);
+        };
+    };
+}
+
+int main() {
+    run_tests();
+    return 0;
+}
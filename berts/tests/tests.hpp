@@ -4,6 +4,7 @@
  * test utilities
  */
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
@@ -291,6 +292,18 @@ inline void berts_assert_(T &&v, const char *expr, const char *testname, const c
 
 } // namespace __test_assets
 
+/// @brief deterministic pseudo-random numbers (Marsaglia's xorshift32) for reproducible test data
+struct xorshift32 {
+    uint32_t x = 2463534242u;
+
+    uint32_t operator()() noexcept {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x;
+    }
+};
+
 #define BERTS_TEST_DEFN_FUNCTION __berts_test_main
 
 #define BERTS_TEST_DEFN()                          \